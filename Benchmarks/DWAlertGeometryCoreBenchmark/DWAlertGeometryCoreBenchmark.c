@@ -0,0 +1,156 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// Throughput of the geometry core for the calls made on every layout pass and scroll event.
+// Usage: DWAlertGeometryCoreBenchmark [iterations]
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "DWAlertGeometryCore.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define INPUTS_COUNT 1024
+
+static volatile double sink_double = 0.0;
+static volatile size_t sink_size = 0;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static double input_value(size_t i, double min, double max) {
+    // deterministic spread of values without involving a PRNG in the measured loop
+    const double unit = (double)((i * 2654435761u) % 1000u) / 1000.0;
+    return min + unit * (max - min);
+}
+
+static void report(const char *name, unsigned long iterations, double elapsed) {
+    printf("%-28s %12lu ops %10.2f ns/op\n", name, iterations, elapsed / (double)iterations);
+}
+
+static void benchmark_maximum_alert_height(unsigned long iterations) {
+    DWAlertGeometryContainer containers[INPUTS_COUNT];
+    for (size_t i = 0; i < INPUTS_COUNT; i++) {
+        containers[i].width = input_value(i, 320.0, 1024.0);
+        containers[i].height = input_value(i + 7, 320.0, 1366.0);
+        containers[i].topInset = input_value(i + 13, 0.0, 44.0);
+        containers[i].bottomInset = i % 2 ? 34.0 : 0.0;
+        containers[i].keyboardHeight = i % 3 ? 0.0 : input_value(i, 216.0, 400.0);
+        containers[i].isPad = i % 5 == 0;
+    }
+
+    double sum = 0.0;
+    const double start = now_ns();
+    for (unsigned long i = 0; i < iterations; i++) {
+        sum += DWAlertGeometryMaximumAlertHeight(containers[i % INPUTS_COUNT]);
+    }
+    report("maximum alert height", iterations, now_ns() - start);
+    sink_double = sum;
+}
+
+static void benchmark_layout_alert(unsigned long iterations) {
+    DWAlertGeometryLayoutInput inputs[INPUTS_COUNT];
+    for (size_t i = 0; i < INPUTS_COUNT; i++) {
+        const double buttonHeight = input_value(i, 44.5, 125.5);
+        const size_t count = 1 + i % 20;
+        inputs[i].separatorSize = 1.0 / 3.0;
+        inputs[i].maxHeight = input_value(i + 3, 300.0, 1300.0);
+        inputs[i].contentHeight = input_value(i + 11, 0.0, 2000.0);
+        inputs[i].actionsHeight = DWAlertGeometryActionsHeight(count, DWAlertGeometryAxisVertical, buttonHeight, 1.0 / 3.0);
+        inputs[i].actionsMinimumHeight = count > 1 ? buttonHeight * 2.0 : buttonHeight;
+        inputs[i].hasActions = true;
+    }
+
+    double sum = 0.0;
+    const double start = now_ns();
+    for (unsigned long i = 0; i < iterations; i++) {
+        const DWAlertGeometryLayout layout = DWAlertGeometryLayoutAlert(inputs[i % INPUTS_COUNT]);
+        sum += layout.contentScrollHeight + layout.actionsScrollHeight;
+    }
+    report("layout alert", iterations, now_ns() - start);
+    sink_double = sum;
+}
+
+static void benchmark_actions_axis(unsigned long iterations) {
+    double widths[INPUTS_COUNT][2];
+    for (size_t i = 0; i < INPUTS_COUNT; i++) {
+        widths[i][0] = input_value(i, 20.0, 200.0);
+        widths[i][1] = input_value(i + 5, 20.0, 200.0);
+    }
+
+    size_t vertical = 0;
+    const double start = now_ns();
+    for (unsigned long i = 0; i < iterations; i++) {
+        vertical += DWAlertGeometryActionsAxis(widths[i % INPUTS_COUNT], 2, 270.0, 1.0 / 3.0) == DWAlertGeometryAxisVertical;
+    }
+    report("actions axis", iterations, now_ns() - start);
+    sink_size = vertical;
+}
+
+static void benchmark_separators_in_rect(unsigned long iterations, size_t actionsCount) {
+    const double buttonHeight = 44.5;
+    const double separatorSize = 1.0 / 3.0;
+    const double totalHeight = DWAlertGeometryActionsHeight(actionsCount, DWAlertGeometryAxisVertical, buttonHeight, separatorSize);
+
+    DWAlertGeometryRect rects[INPUTS_COUNT];
+    for (size_t i = 0; i < INPUTS_COUNT; i++) {
+        // visible rect of a scrolled actions view with the rendering margins
+        rects[i].x = 0.0;
+        rects[i].y = input_value(i, -300.0, totalHeight);
+        rects[i].width = 270.0;
+        rects[i].height = 900.0;
+    }
+
+    size_t sum = 0;
+    const double start = now_ns();
+    for (unsigned long i = 0; i < iterations; i++) {
+        const DWAlertGeometryRange range = DWAlertGeometrySeparatorsInRect(rects[i % INPUTS_COUNT], actionsCount,
+                                                                           DWAlertGeometryAxisVertical, 270.0,
+                                                                           buttonHeight, separatorSize);
+        sum += range.length;
+    }
+
+    char name[64];
+    snprintf(name, sizeof(name), "separators in rect (%zu)", actionsCount);
+    report(name, iterations, now_ns() - start);
+    sink_size = sum;
+}
+
+int main(int argc, char *argv[]) {
+    unsigned long iterations = 10000000;
+    if (argc > 1) {
+        iterations = strtoul(argv[1], NULL, 10);
+        if (iterations == 0) {
+            fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    benchmark_maximum_alert_height(iterations);
+    benchmark_layout_alert(iterations);
+    benchmark_actions_axis(iterations);
+    benchmark_separators_in_rect(iterations, 10);
+    benchmark_separators_in_rect(iterations, 1000);
+    benchmark_separators_in_rect(iterations, 100000);
+
+    return 0;
+}
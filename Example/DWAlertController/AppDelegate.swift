@@ -22,6 +22,13 @@ class AppDelegate: UIResponder, UIApplicationDelegate {
     var window: UIWindow?
 
     func application(_ application: UIApplication, didFinishLaunchingWithOptions launchOptions: [UIApplication.LaunchOptionsKey : Any]? = nil) -> Bool {
+        // Launch arguments are available via UserDefaults, e.g. `-DWStressTest YES`
+        let defaults = UserDefaults.standard
+        if defaults.bool(forKey: StressTestViewController.enabledKey) {
+            let iterations = defaults.integer(forKey: StressTestViewController.iterationsKey)
+            window?.rootViewController = StressTestViewController(iterations: iterations > 0 ? iterations : 1000)
+        }
+        
         return true
     }
 }
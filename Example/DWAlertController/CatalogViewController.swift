@@ -34,6 +34,7 @@ class CatalogViewController: UITableViewController {
         case tinted = 6
         case alwaysLight = 7
         case alwaysDark = 8
+        case lightweightActions = 9
     }
     
     override func viewDidLoad() {
@@ -71,6 +72,8 @@ class CatalogViewController: UITableViewController {
             showAlwaysLightAlert()
         case .alwaysDark:
             showAlwaysDarkAlert()
+        case .lightweightActions:
+            showLightweightActionsAlert()
         }
     }
     
@@ -100,9 +103,8 @@ class CatalogViewController: UITableViewController {
     }
     
     private func showTitleMessageAlert() {
-        let controller = TitleMessageViewController(title: alertTitle,
-                                                    message: alertMessage)
-        let alert = DWAlertController(contentController: controller)
+        // Title / message alerts don't require a content controller
+        let alert = DWAlertController(title: alertTitle, message: alertMessage)
         
         let okAction = DWAlertAction(title: NSLocalizedString("OK", comment: ""),
                                      style: .default,
@@ -231,5 +233,30 @@ class CatalogViewController: UITableViewController {
         
         present(alert, animated: true)
     }
+    
+    private func showLightweightActionsAlert() {
+        let alert = DWAlertController(title: alertTitle, message: alertMessage)
+        // Must be set before adding actions
+        alert.usesLightweightActionViews = true
+        
+        let okAction = DWAlertAction(title: NSLocalizedString("OK", comment: ""),
+                                     style: .default,
+                                     handler: nil)
+        alert.addAction(okAction)
+        alert.preferredAction = okAction
+        
+        let destructiveAction = DWAlertAction(title: NSLocalizedString("Delete", comment: ""),
+                                              style: .destructive,
+                                              handler: nil)
+        alert.addAction(destructiveAction)
+        
+        let cancelAction = DWAlertAction(title: NSLocalizedString("Cancel", comment: ""),
+                                         style: .cancel,
+                                         handler: nil)
+        cancelAction.isEnabled = false
+        alert.addAction(cancelAction)
+        
+        present(alert, animated: true)
+    }
 }
 
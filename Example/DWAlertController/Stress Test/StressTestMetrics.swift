@@ -0,0 +1,224 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+import UIKit
+
+/// Collects frame drops, main thread stalls and memory footprint while the stress test is running.
+/// Every sample is attributed to the currently running scenario.
+final class StressTestMetrics {
+    struct Counters: Codable {
+        var frames = 0
+        var droppedFrames = 0
+        var hitchTime: TimeInterval = 0
+        var worstFrameTime: TimeInterval = 0
+        var stalls = 0
+        var stallTime: TimeInterval = 0
+        var worstStallTime: TimeInterval = 0
+        var iterations = 0
+        /// Content size categories in effect while the scenario was running
+        var contentSizeCategories = [String]()
+    }
+
+    /// Main thread busy periods longer than that are reported as stalls
+    static let stallThreshold: TimeInterval = 0.05
+
+    var scenario = "idle"
+
+    private(set) var total = Counters()
+    private(set) var scenarios = [String: Counters]()
+    private(set) var startMemoryFootprint: UInt64 = 0
+    private(set) var peakMemoryFootprint: UInt64 = 0
+    private(set) var stallDurations = [TimeInterval]()
+
+    private var displayLink: CADisplayLink?
+    private var lastFrameTimestamp: CFTimeInterval = 0
+    private var runLoopObserver: CFRunLoopObserver?
+    private var runLoopBusyStart: CFTimeInterval = 0
+
+    func start() {
+        startMemoryFootprint = StressTestMetrics.memoryFootprint()
+        peakMemoryFootprint = startMemoryFootprint
+
+        let displayLink = CADisplayLink(target: self, selector: #selector(displayLinkDidFire(_:)))
+        displayLink.add(to: .main, forMode: .common)
+        self.displayLink = displayLink
+
+        // Time spent between waking up and going to sleep is the time main thread was busy
+        let activities = CFRunLoopActivity.afterWaiting.rawValue | CFRunLoopActivity.beforeWaiting.rawValue
+        let observer = CFRunLoopObserverCreateWithHandler(nil, activities, true, 0) { [weak self] _, activity in
+            self?.runLoopDidChangeActivity(activity)
+        }
+        CFRunLoopAddObserver(CFRunLoopGetMain(), observer, .commonModes)
+        runLoopObserver = observer
+    }
+
+    func stop() {
+        displayLink?.invalidate()
+        displayLink = nil
+
+        if let observer = runLoopObserver {
+            CFRunLoopRemoveObserver(CFRunLoopGetMain(), observer, .commonModes)
+            runLoopObserver = nil
+        }
+    }
+
+    func iterationDidFinish() {
+        update { $0.iterations += 1 }
+    }
+
+    func recordContentSizeCategory(_ category: UIContentSizeCategory) {
+        update {
+            if !$0.contentSizeCategories.contains(category.rawValue) {
+                $0.contentSizeCategories.append(category.rawValue)
+            }
+        }
+    }
+
+    // MARK: Private
+
+    @objc
+    private func displayLinkDidFire(_ displayLink: CADisplayLink) {
+        defer {
+            lastFrameTimestamp = displayLink.timestamp
+        }
+
+        let footprint = StressTestMetrics.memoryFootprint()
+        peakMemoryFootprint = max(peakMemoryFootprint, footprint)
+
+        guard lastFrameTimestamp > 0, displayLink.duration > 0 else {
+            return
+        }
+
+        let frameTime = displayLink.timestamp - lastFrameTimestamp
+        let expectedFrameTime = displayLink.duration
+        let dropped = max(0, Int((frameTime / expectedFrameTime).rounded()) - 1)
+        update {
+            $0.frames += 1
+            $0.droppedFrames += dropped
+            $0.worstFrameTime = max($0.worstFrameTime, frameTime)
+            if dropped > 0 {
+                $0.hitchTime += frameTime - expectedFrameTime
+            }
+        }
+    }
+
+    private func runLoopDidChangeActivity(_ activity: CFRunLoopActivity) {
+        let now = CACurrentMediaTime()
+        if activity == .afterWaiting {
+            runLoopBusyStart = now
+            return
+        }
+
+        guard runLoopBusyStart > 0 else {
+            return
+        }
+
+        let busyTime = now - runLoopBusyStart
+        runLoopBusyStart = 0
+        guard busyTime > StressTestMetrics.stallThreshold else {
+            return
+        }
+
+        stallDurations.append(busyTime)
+        update {
+            $0.stalls += 1
+            $0.stallTime += busyTime
+            $0.worstStallTime = max($0.worstStallTime, busyTime)
+        }
+    }
+
+    private func update(_ block: (inout Counters) -> Void) {
+        block(&total)
+        var counters = scenarios[scenario] ?? Counters()
+        block(&counters)
+        scenarios[scenario] = counters
+    }
+
+    private static func memoryFootprint() -> UInt64 {
+        var info = task_vm_info_data_t()
+        var count = mach_msg_type_number_t(MemoryLayout<task_vm_info_data_t>.size / MemoryLayout<natural_t>.size)
+        let result = withUnsafeMutablePointer(to: &info) {
+            $0.withMemoryRebound(to: integer_t.self, capacity: Int(count)) {
+                task_info(mach_task_self_, task_flavor_t(TASK_VM_INFO), $0, &count)
+            }
+        }
+
+        return result == KERN_SUCCESS ? info.phys_footprint : 0
+    }
+}
+
+/// Machine-readable result of the stress test run
+struct StressTestReport: Codable {
+    struct Memory: Codable {
+        let startFootprint: UInt64
+        let peakFootprint: UInt64
+    }
+
+    struct Stalls: Codable {
+        let threshold: TimeInterval
+        let p50: TimeInterval
+        let p95: TimeInterval
+        let p99: TimeInterval
+    }
+
+    let libraryVersion: String
+    let systemVersion: String
+    let deviceModel: String
+    let duration: TimeInterval
+    let total: StressTestMetrics.Counters
+    let scenarios: [String: StressTestMetrics.Counters]
+    let stalls: Stalls
+    let memory: Memory
+
+    init(metrics: StressTestMetrics, duration: TimeInterval, libraryBundle: Bundle) {
+        libraryVersion = libraryBundle.object(forInfoDictionaryKey: "CFBundleShortVersionString") as? String ?? "unknown"
+        systemVersion = UIDevice.current.systemVersion
+        deviceModel = StressTestReport.deviceModel()
+        self.duration = duration
+        total = metrics.total
+        scenarios = metrics.scenarios
+
+        let sortedStalls = metrics.stallDurations.sorted()
+        func percentile(_ p: Double) -> TimeInterval {
+            guard !sortedStalls.isEmpty else { return 0 }
+            let index = min(sortedStalls.count - 1, Int(Double(sortedStalls.count) * p))
+            return sortedStalls[index]
+        }
+        stalls = Stalls(threshold: StressTestMetrics.stallThreshold,
+                        p50: percentile(0.5),
+                        p95: percentile(0.95),
+                        p99: percentile(0.99))
+
+        memory = Memory(startFootprint: metrics.startMemoryFootprint,
+                        peakFootprint: metrics.peakMemoryFootprint)
+    }
+
+    func write(to url: URL) throws {
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = .prettyPrinted
+        try encoder.encode(self).write(to: url, options: .atomic)
+    }
+
+    private static func deviceModel() -> String {
+        var systemInfo = utsname()
+        uname(&systemInfo)
+        return withUnsafeBytes(of: &systemInfo.machine) {
+            String(cString: $0.bindMemory(to: CChar.self).baseAddress!)
+        }
+    }
+}
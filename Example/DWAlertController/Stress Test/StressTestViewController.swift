@@ -0,0 +1,229 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+import UIKit
+import DWAlertController
+
+/// Presents, updates and dismisses alerts of the catalog back to back while recording
+/// dropped frames, main thread stalls and memory footprint.
+///
+/// Launch the Example app with `-DWStressTest YES` (and optionally `-DWStressTestIterations 3000`)
+/// to run it. The report is written as JSON into the Documents directory and is printed to the console
+/// so it can be collected and compared between library versions.
+///
+/// The alerts use the system content size category, the one in effect is recorded for every scenario.
+/// To cover different categories run the test once per Text Size setting.
+final class StressTestViewController: UIViewController {
+    static let enabledKey = "DWStressTest"
+    static let iterationsKey = "DWStressTestIterations"
+
+    enum Scenario: String, CaseIterable {
+        case titleMessage
+        case rich
+        case longText
+        case passcode
+        case form
+    }
+
+    init(iterations: Int) {
+        self.iterations = iterations
+
+        super.init(nibName: nil, bundle: nil)
+    }
+
+    required init?(coder aDecoder: NSCoder) {
+        fatalError("init(coder:) has not been implemented")
+    }
+
+    override func viewDidLoad() {
+        super.viewDidLoad()
+
+        if #available(iOS 13.0, *) {
+            view.backgroundColor = .systemBackground
+        } else {
+            view.backgroundColor = .white
+        }
+
+        statusLabel.frame = view.bounds
+        statusLabel.autoresizingMask = [.flexibleWidth, .flexibleHeight]
+        statusLabel.textAlignment = .center
+        statusLabel.numberOfLines = 0
+        view.addSubview(statusLabel)
+    }
+
+    override func viewDidAppear(_ animated: Bool) {
+        super.viewDidAppear(animated)
+
+        guard startTime == 0 else {
+            return
+        }
+
+        startTime = CACurrentMediaTime()
+        metrics.start()
+        runNextIteration()
+    }
+
+    // MARK: Private
+
+    /// Pause between the steps of a single iteration
+    private static let stepDelay: TimeInterval = 0.1
+
+    private let iterations: Int
+    private let statusLabel = UILabel()
+    private let metrics = StressTestMetrics()
+    private var iteration = 0
+    private var startTime: CFTimeInterval = 0
+
+    private func runNextIteration() {
+        guard iteration < iterations else {
+            finish()
+            return
+        }
+
+        let scenarios = Scenario.allCases
+        let scenario = scenarios[iteration % scenarios.count]
+        metrics.scenario = scenario.rawValue
+        // the library reads the application-wide category
+        metrics.recordContentSizeCategory(UIApplication.shared.preferredContentSizeCategory)
+        statusLabel.text = "\(iteration + 1) / \(iterations)\n\(scenario.rawValue)"
+
+        let alert = makeAlert(for: scenario)
+        present(alert, animated: true) {
+            self.performAfterDelay {
+                alert.setupActions(self.makeSwappedActions(), animated: true)
+
+                self.performAfterDelay {
+                    self.toggleKeyboard(in: alert.view) {
+                        alert.dismiss(animated: true) {
+                            self.metrics.iterationDidFinish()
+                            self.iteration += 1
+                            self.runNextIteration()
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    private func finish() {
+        metrics.stop()
+
+        let report = StressTestReport(metrics: metrics,
+                                      duration: CACurrentMediaTime() - startTime,
+                                      libraryBundle: Bundle(for: DWAlertController.self))
+        let documents = FileManager.default.urls(for: .documentDirectory, in: .userDomainMask).first!
+        let url = documents.appendingPathComponent("StressTestReport-\(Int(Date().timeIntervalSince1970)).json")
+        do {
+            try report.write(to: url)
+            print("DWStressTest: report written to \(url.path)")
+            if let json = try? String(contentsOf: url) {
+                print(json)
+            }
+            statusLabel.text = "Done\n\(url.lastPathComponent)"
+        } catch {
+            print("DWStressTest: failed to write report: \(error)")
+            statusLabel.text = "Failed to write report"
+        }
+    }
+
+    private func makeAlert(for scenario: Scenario) -> DWAlertController {
+        let alert: DWAlertController
+        switch scenario {
+        case .titleMessage:
+            alert = DWAlertController(title: "Hey I'm an alert",
+                                      message: "Lorem ipsum dolor sit amet, consectetur adipiscing elit")
+        case .rich:
+            alert = DWAlertController(contentController: RichViewController.controller())
+        case .longText:
+            let controller = UIStoryboard(name: "LongText", bundle: nil).instantiateInitialViewController()!
+            alert = DWAlertController(contentController: controller)
+        case .passcode:
+            alert = DWAlertController(contentController: PasscodeViewController())
+        case .form:
+            // sets up its own actions
+            return AdvancedAlertViewController()
+        }
+
+        let okAction = DWAlertAction(title: NSLocalizedString("OK", comment: ""),
+                                     style: .default,
+                                     handler: nil)
+        okAction.identifier = "ok"
+        alert.addAction(okAction)
+        alert.preferredAction = okAction
+
+        let cancelAction = DWAlertAction(title: NSLocalizedString("Cancel", comment: ""),
+                                         style: .cancel,
+                                         handler: nil)
+        alert.addAction(cancelAction)
+
+        return alert
+    }
+
+    /// Varying number of actions to exercise both reuse and creation of the action views
+    private func makeSwappedActions() -> [DWAlertAction] {
+        var actions = (0 ..< iteration % 4).map {
+            DWAlertAction(title: "Action \($0 + 1)", style: .default, handler: nil)
+        }
+
+        let okAction = DWAlertAction(title: NSLocalizedString("OK", comment: ""),
+                                     style: .default,
+                                     handler: nil)
+        okAction.identifier = "ok"
+        actions.append(okAction)
+
+        let destructiveAction = DWAlertAction(title: NSLocalizedString("Delete", comment: ""),
+                                              style: .destructive,
+                                              handler: nil)
+        actions.append(destructiveAction)
+
+        return actions
+    }
+
+    private func toggleKeyboard(in view: UIView, completion: @escaping () -> Void) {
+        guard let responder = view.stressTest_firstResponder() else {
+            completion()
+            return
+        }
+
+        _ = responder.resignFirstResponder()
+        performAfterDelay {
+            _ = responder.becomeFirstResponder()
+            self.performAfterDelay(completion)
+        }
+    }
+
+    private func performAfterDelay(_ block: @escaping () -> Void) {
+        DispatchQueue.main.asyncAfter(deadline: .now() + StressTestViewController.stepDelay, execute: block)
+    }
+}
+
+private extension UIView {
+    func stressTest_firstResponder() -> UIView? {
+        if isFirstResponder {
+            return self
+        }
+
+        for subview in subviews {
+            if let responder = subview.stressTest_firstResponder() {
+                return responder
+            }
+        }
+
+        return nil
+    }
+}
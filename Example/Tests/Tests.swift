@@ -1,3 +1,4 @@
+import UIKit
 import XCTest
 import DWAlertController
 
@@ -25,4 +26,374 @@ class Tests: XCTestCase {
         }
     }
     
+    // MARK: Title / Message alert vs content controller
+    
+    private let alertTitle = "Hey I'm an alert"
+    private let alertMessage = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor"
+    private let alertsCount = 100
+    
+    func testPerformanceTitleMessageAlert() {
+        self.measure() {
+            for _ in 0..<alertsCount {
+                let alert = DWAlertController(title: alertTitle, message: alertMessage)
+                layoutAlert(alert)
+            }
+        }
+    }
+    
+    func testPerformanceContentControllerAlert() {
+        self.measure() {
+            for _ in 0..<alertsCount {
+                let controller = LabelsViewController(title: alertTitle, message: alertMessage)
+                let alert = DWAlertController(contentController: controller)
+                layoutAlert(alert)
+            }
+        }
+    }
+    
+    private func layoutAlert(_ alert: DWAlertController) {
+        alert.addAction(DWAlertAction(title: "OK", style: .cancel, handler: nil))
+        alert.view.frame = UIScreen.main.bounds
+        alert.view.setNeedsLayout()
+        alert.view.layoutIfNeeded()
+    }
+    
+    // MARK: Replacement
+    
+    func testReplaceDuringDismissalKeepsDimming() {
+        guard let window = UIApplication.shared.keyWindow, var presenter = window.rootViewController else {
+            XCTFail("Test host has no window")
+            return
+        }
+        while let presented = presenter.presentedViewController {
+            presenter = presented
+        }
+    
+        let alert = DWAlertController(title: alertTitle, message: alertMessage)
+        alert.addAction(DWAlertAction(title: "OK", style: .cancel, handler: nil))
+        let presented = expectation(description: "alert is presented")
+        presenter.present(alert, animated: true) {
+            presented.fulfill()
+        }
+        wait(for: [presented], timeout: 5.0)
+    
+        let dimmingViews = self.dimmingViews(in: window)
+        XCTAssertEqual(dimmingViews.count, 1)
+        guard let dimmingView = dimmingViews.first else {
+            return
+        }
+        XCTAssertEqual(dimmingView.alpha, 1.0)
+    
+        let replacement = DWAlertController(title: alertTitle, message: alertMessage)
+        replacement.addAction(DWAlertAction(title: "OK", style: .cancel, handler: nil))
+        let replaced = expectation(description: "alert is replaced")
+    
+        alert.dismiss(animated: true, completion: nil)
+        // replace in the middle of the dismissal animation
+        DispatchQueue.main.asyncAfter(deadline: .now() + 0.1) {
+            XCTAssertTrue(alert.isBeingDismissed)
+            alert.replace(with: replacement) {
+                replaced.fulfill()
+            }
+    
+            // the dismissal stops where it is instead of dropping the dimming to 0
+            XCTAssertGreaterThan(dimmingView.alpha, 0.0)
+            XCTAssertEqual(presenter.view.tintAdjustmentMode, .dimmed)
+        }
+        wait(for: [replaced], timeout: 5.0)
+    
+        XCTAssertTrue(presenter.presentedViewController === replacement)
+        XCTAssertEqual(self.dimmingViews(in: window), [dimmingView])
+        XCTAssertEqual(dimmingView.alpha, 1.0)
+        XCTAssertEqual(presenter.view.tintAdjustmentMode, .dimmed)
+    
+        let dismissed = expectation(description: "replacement is dismissed")
+        replacement.dismiss(animated: false) {
+            dismissed.fulfill()
+        }
+        wait(for: [dismissed], timeout: 5.0)
+        XCTAssertTrue(self.dimmingViews(in: window).isEmpty)
+    }
+    
+    // MARK: Long text
+    
+    func testLongTextEstimatedHeightConvergesAfterScrollingToTheEnd() {
+        // lines of different lengths so the estimate from the beginning of the text is inaccurate
+        let text = (0..<3000).map { index -> String in
+            String(repeating: "Lorem ipsum dolor sit amet ", count: index % 7 + 1)
+        }.joined(separator: "\n")
+        let controller = DWAlertLongTextContentController(text: text)
+        let alert = DWAlertController(contentController: controller)
+        alert.view.frame = UIScreen.main.bounds
+        alert.view.layoutIfNeeded()
+        
+        let textView: UIView = controller.view
+        guard let scrollView = enclosingScrollView(of: textView) else {
+            XCTFail("Long text is not inside of the content scroll view")
+            return
+        }
+        
+        // jump straight to the end like a thumb drag does, the estimate grows until the end is reached
+        var previousHeight: CGFloat = -1.0
+        for _ in 0..<50 {
+            let height = textView.intrinsicContentSize.height
+            if height == previousHeight {
+                break
+            }
+            previousHeight = height
+            scrollView.contentOffset = CGPoint(x: 0.0, y: max(0.0, scrollView.contentSize.height - scrollView.bounds.height))
+            alert.view.layoutIfNeeded()
+        }
+        
+        let textStorage = NSTextStorage(attributedString: controller.attributedText)
+        let layoutManager = NSLayoutManager()
+        let textContainer = NSTextContainer(size: CGSize(width: textView.bounds.width, height: .greatestFiniteMagnitude))
+        textContainer.lineFragmentPadding = 0.0
+        layoutManager.addTextContainer(textContainer)
+        textStorage.addLayoutManager(layoutManager)
+        layoutManager.ensureLayout(for: textContainer)
+        let expectedHeight = ceil(layoutManager.usedRect(for: textContainer).height)
+        
+        XCTAssertEqual(textView.intrinsicContentSize.height, expectedHeight, accuracy: 1.0)
+    }
+    
+    // MARK: Lightweight action views
+    
+    func testLightweightActionViewsMatchButtons() {
+        let buttonsAlert = DWAlertController(title: alertTitle, message: alertMessage)
+        let lightweightAlert = DWAlertController(title: alertTitle, message: alertMessage)
+        lightweightAlert.usesLightweightActionViews = true
+        
+        var disabledActions = [DWAlertAction]()
+        for alert in [buttonsAlert, lightweightAlert] {
+            alert.addAction(DWAlertAction(title: "OK", style: .default, handler: nil))
+            let cancelAction = DWAlertAction(title: "Cancel", style: .cancel, handler: nil)
+            cancelAction.isEnabled = false
+            alert.addAction(cancelAction)
+            disabledActions.append(cancelAction)
+            
+            alert.view.frame = UIScreen.main.bounds
+            alert.view.layoutIfNeeded()
+        }
+        
+        let buttons = views(ofClassNamed: "DWAlertViewActionButton", in: buttonsAlert.view)
+        let layerViews = views(ofClassNamed: "DWAlertViewActionLayerView", in: lightweightAlert.view)
+        XCTAssertEqual(buttons.count, 2)
+        XCTAssertEqual(layerViews.count, 2)
+        XCTAssertTrue(views(ofClassNamed: "DWAlertViewActionButton", in: lightweightAlert.view).isEmpty)
+        XCTAssertEqual(Set(layerViews.compactMap { $0.accessibilityLabel }), ["OK", "Cancel"])
+        XCTAssertEqual(Set(buttons.compactMap { $0.accessibilityLabel }), ["OK", "Cancel"])
+        
+        let pixel = 1.0 / UIScreen.main.scale
+        let compareViews = {
+            for layerView in layerViews {
+                guard let button = buttons.first(where: { $0.accessibilityLabel == layerView.accessibilityLabel }) else {
+                    XCTFail("No button for action view \(String(describing: layerView.accessibilityLabel))")
+                    continue
+                }
+                
+                // the button is sized by its label constraints, that's how the actions stack view measures it
+                let buttonSize = button.systemLayoutSizeFitting(UIView.layoutFittingCompressedSize)
+                XCTAssertEqual(layerView.intrinsicContentSize.width, buttonSize.width, accuracy: pixel)
+                XCTAssertEqual(layerView.intrinsicContentSize.height, buttonSize.height, accuracy: pixel)
+                XCTAssertEqual(layerView.accessibilityTraits, button.accessibilityTraits)
+            }
+        }
+        
+        compareViews()
+        for layerView in layerViews where layerView.accessibilityLabel == "Cancel" {
+            XCTAssertTrue(layerView.accessibilityTraits.contains(.notEnabled))
+        }
+        
+        // enabled state changes after the views are created are reflected the same way
+        for action in disabledActions {
+            action.isEnabled = true
+        }
+        compareViews()
+        for layerView in layerViews {
+            XCTAssertFalse(layerView.accessibilityTraits.contains(.notEnabled))
+        }
+    }
+    
+    func testLightweightActionViewTruncatesLongTitle() {
+        let title = String(repeating: "Very long action title ", count: 10)
+        let alert = DWAlertController(title: alertTitle, message: alertMessage)
+        alert.usesLightweightActionViews = true
+        alert.addAction(DWAlertAction(title: title, style: .default, handler: nil))
+        alert.view.frame = UIScreen.main.bounds
+        alert.view.layoutIfNeeded()
+        
+        guard let layerView = views(ofClassNamed: "DWAlertViewActionLayerView", in: alert.view).first else {
+            XCTFail("Lightweight action view is not found")
+            return
+        }
+        layerView.layoutIfNeeded()
+        XCTAssertEqual(layerView.accessibilityLabel, title)
+        
+        let naturalWidth = (title as NSString).size(withAttributes: [.font: UIFont.preferredFont(forTextStyle: .body)]).width
+        XCTAssertGreaterThan(naturalWidth, layerView.bounds.width)
+        
+        let titleLayers = layerView.layer.sublayers?.filter { $0.contents != nil } ?? []
+        XCTAssertEqual(titleLayers.count, 1)
+        for titleLayer in titleLayers {
+            XCTAssertGreaterThan(titleLayer.bounds.width, 0.0)
+            XCTAssertGreaterThanOrEqual(titleLayer.frame.minX, 0.0)
+            XCTAssertLessThanOrEqual(titleLayer.frame.maxX, layerView.bounds.width)
+        }
+    }
+    
+    // MARK: Measurement
+    
+    func testPreparedAlertLaysOutToTheSameHeight() {
+        let alert = DWAlertController(title: alertTitle, message: alertMessage)
+        layoutAlert(alert)
+        
+        let preparedAlert = DWAlertController(title: alertTitle, message: alertMessage)
+        preparedAlert.addAction(DWAlertAction(title: "OK", style: .cancel, handler: nil))
+        prepareForPresentation(preparedAlert)
+        preparedAlert.view.frame = UIScreen.main.bounds
+        preparedAlert.view.layoutIfNeeded()
+        
+        guard let alertView = views(ofClassNamed: "DWAlertView", in: alert.view).first,
+            let preparedAlertView = views(ofClassNamed: "DWAlertView", in: preparedAlert.view).first else {
+            XCTFail("Alert view is not found")
+            return
+        }
+        XCTAssertGreaterThan(alertView.bounds.height, 0.0)
+        XCTAssertEqual(preparedAlertView.bounds.height, alertView.bounds.height)
+    }
+    
+    func testPreparedAlertWithLongActionTitlesIsVertical() {
+        let title = String(repeating: "Long action title ", count: 3)
+        let alert = DWAlertController(title: alertTitle, message: alertMessage)
+        alert.addAction(DWAlertAction(title: title, style: .default, handler: nil))
+        alert.addAction(DWAlertAction(title: title, style: .cancel, handler: nil))
+        prepareForPresentation(alert)
+        alert.view.frame = UIScreen.main.bounds
+        alert.view.layoutIfNeeded()
+        
+        guard let stackView = actionsStackView(of: alert),
+            let measurement = stackView.value(forKey: "measurement") as? NSObject else {
+            XCTFail("Measurement is not attached")
+            return
+        }
+        XCTAssertEqual(measurement.value(forKey: "validForCurrentEnvironment") as? Bool, true)
+        XCTAssertEqual(stackView.axis, .vertical)
+    }
+    
+    func testMeasurementIsIgnoredAfterContentSizeCategoryChange() {
+        let alert = DWAlertController(title: alertTitle, message: alertMessage)
+        alert.addAction(DWAlertAction(title: "OK", style: .default, handler: nil))
+        alert.addAction(DWAlertAction(title: "Cancel", style: .cancel, handler: nil))
+        prepareForPresentation(alert)
+        alert.view.frame = UIScreen.main.bounds
+        alert.view.layoutIfNeeded()
+        
+        guard let stackView = actionsStackView(of: alert),
+            let measurement = stackView.value(forKey: "measurement") as? NSObject else {
+            XCTFail("Measurement is not attached")
+            return
+        }
+        XCTAssertEqual(stackView.axis, .horizontal)
+        
+        // pretend the titles were measured too wide, the axis follows a valid measurement
+        let tooWide = NSNumber(value: Double(UIScreen.main.bounds.width))
+        measurement.setValue(["0|OK": tooWide, "1|OK": tooWide, "0|Cancel": tooWide, "1|Cancel": tooWide],
+                             forKey: "actionTitleWidths")
+        stackView.setValue(measurement, forKey: "measurement")
+        XCTAssertEqual(stackView.axis, .vertical)
+        
+        // once the category differs the measurement is ignored and the titles are measured by the views
+        let category = UIApplication.shared.preferredContentSizeCategory
+        let otherCategory: UIContentSizeCategory = category == .extraExtraExtraLarge ? .small : .extraExtraExtraLarge
+        measurement.setValue(otherCategory.rawValue, forKey: "contentSizeCategory")
+        XCTAssertEqual(measurement.value(forKey: "validForCurrentEnvironment") as? Bool, false)
+        stackView.setValue(measurement, forKey: "measurement")
+        XCTAssertEqual(stackView.axis, .horizontal)
+    }
+    
+    private func prepareForPresentation(_ alert: DWAlertController) {
+        let prepared = expectation(description: "alert is prepared")
+        alert.prepareForPresentation {
+            prepared.fulfill()
+        }
+        wait(for: [prepared], timeout: 5.0)
+    }
+    
+    private func actionsStackView(of alert: DWAlertController) -> UIStackView? {
+        return views(ofClassNamed: "DWActionsStackView", in: alert.view).first as? UIStackView
+    }
+    
+    private func enclosingScrollView(of view: UIView) -> UIScrollView? {
+        var superview = view.superview
+        while let candidate = superview {
+            if let scrollView = candidate as? UIScrollView {
+                return scrollView
+            }
+            superview = candidate.superview
+        }
+        return nil
+    }
+    
+    private func dimmingViews(in view: UIView) -> [UIView] {
+        return views(ofClassNamed: "DWDimmingView", in: view)
+    }
+    
+    private func views(ofClassNamed className: String, in view: UIView) -> [UIView] {
+        guard let viewClass = NSClassFromString(className) else {
+            return []
+        }
+        var result = view.isKind(of: viewClass) ? [view] : []
+        for subview in view.subviews {
+            result += views(ofClassNamed: className, in: subview)
+        }
+        return result
+    }
+}
+
+/// Minimal title / message content controller matching the one from the Example app
+private class LabelsViewController: UIViewController {
+    private let titleText: String
+    private let messageText: String
+    
+    init(title: String, message: String) {
+        titleText = title
+        messageText = message
+        
+        super.init(nibName: nil, bundle: nil)
+    }
+    
+    required init?(coder aDecoder: NSCoder) {
+        fatalError("init(coder:) has not been implemented")
+    }
+    
+    override func viewDidLoad() {
+        super.viewDidLoad()
+        
+        let titleLabel = UILabel()
+        titleLabel.font = UIFont.preferredFont(forTextStyle: .headline)
+        titleLabel.textAlignment = .center
+        titleLabel.numberOfLines = 0
+        titleLabel.text = titleText
+        
+        let messageLabel = UILabel()
+        messageLabel.font = UIFont.preferredFont(forTextStyle: .footnote)
+        messageLabel.textAlignment = .center
+        messageLabel.numberOfLines = 0
+        messageLabel.text = messageText
+        
+        let stackView = UIStackView(arrangedSubviews: [titleLabel, messageLabel])
+        stackView.translatesAutoresizingMaskIntoConstraints = false
+        stackView.axis = .vertical
+        stackView.alignment = .center
+        stackView.spacing = 4
+        view.addSubview(stackView)
+        
+        NSLayoutConstraint.activate([
+            stackView.topAnchor.constraint(equalTo: view.topAnchor),
+            stackView.leadingAnchor.constraint(equalTo: view.leadingAnchor),
+            stackView.bottomAnchor.constraint(equalTo: view.bottomAnchor),
+            stackView.trailingAnchor.constraint(equalTo: view.trailingAnchor),
+            ])
+    }
 }
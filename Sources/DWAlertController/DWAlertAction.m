@@ -25,6 +25,14 @@ NS_ASSUME_NONNULL_BEGIN
     return [[self alloc] initWithTitle:title style:style handler:handler];
 }
 
++ (instancetype)actionWithTitle:(nullable NSString *)title style:(DWAlertActionStyle)style asyncHandler:(DWAlertActionAsyncHandler)asyncHandler {
+    NSParameterAssert(asyncHandler);
+
+    DWAlertAction *action = [[self alloc] initWithTitle:title style:style handler:nil];
+    action.asyncHandler = asyncHandler;
+    return action;
+}
+
 - (instancetype)initWithTitle:(nullable NSString *)title style:(DWAlertActionStyle)style handler:(void (^__nullable)(DWAlertAction *action))handler {
     self = [super init];
     if (self) {
@@ -32,10 +40,23 @@ NS_ASSUME_NONNULL_BEGIN
         _style = style;
         _handler = [handler copy];
         _enabled = YES;
+        _showsActivityIndicator = YES;
     }
     return self;
 }
 
+- (void)setEnabled:(BOOL)enabled {
+    _enabled = enabled;
+    _enabledChangesCount += 1;
+}
+
+- (dispatch_queue_t)handlerQueue {
+    if (!_handlerQueue) {
+        _handlerQueue = dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0);
+    }
+    return _handlerQueue;
+}
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -17,27 +17,50 @@
 
 #import "DWAlertController/DWAlertController.h"
 
+#import <QuartzCore/QuartzCore.h>
+#import <os/signpost.h>
+
 #import "Private/DWAlertAction+DWProtected.h"
 #import "Private/DWAlertController+DWKeyboard.h"
 #import "Private/DWAlertDismissalAnimationController.h"
 #import "Private/DWAlertInternalConstants.h"
+#import "Private/DWAlertOverlayWindow.h"
 #import "Private/DWAlertPresentationAnimationController.h"
 #import "Private/DWAlertPresentationController.h"
 #import "Private/DWAlertView.h"
 #import "Private/DWAlertViewActionBaseView.h"
+#import "Private/DWAlertViewActionLayerView.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
+API_AVAILABLE(ios(12.0))
+static os_log_t DWAlertActionsLog(void) {
+    static os_log_t log = NULL;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        log = os_log_create("DWAlertController", "Actions");
+    });
+    return log;
+}
+
 @interface DWAlertController () <UIViewControllerTransitioningDelegate, DWAlertViewDelegate>
 
 @property (null_resettable, strong, nonatomic) DWAlertView *alertView;
 @property (strong, nonatomic) NSLayoutConstraint *alertViewCenterYConstraint;
 @property (strong, nonatomic) NSLayoutConstraint *alertViewHeightConstraint;
+/// Container the alert is laid out in, captured once per size change
+@property (assign, nonatomic) DWAlertGeometryContainer geometryContainer;
 
 @property (nullable, strong, nonatomic) __kindof UIViewController *contentController;
 @property (copy, nonatomic) NSArray<DWAlertAction *> *actions;
 
 @property (nullable, nonatomic, weak) DWAlertPresentationController *alertPresentationController;
+@property (nullable, nonatomic, weak) DWAlertBaseAnimationController *transitionAnimationController;
+@property (nullable, nonatomic, strong) DWDimmingView *handOffDimmingView;
+@property (nullable, nonatomic, copy) void (^pendingReplacementBlock)(void);
+@property (nullable, nonatomic, strong) DWAlertAction *executingAction;
+@property (assign, nonatomic) BOOL hasTitleMessageContent;
+@property (assign, nonatomic) BOOL presentedInOverlayWindow;
 
 // hides warning
 + (instancetype)appearanceWhenContainedIn:(nullable Class<UIAppearanceContainer>)ContainerClass, ... __attribute__((deprecated));
@@ -54,20 +77,34 @@ NS_ASSUME_NONNULL_BEGIN
     return [[self alloc] initWithContentController:contentController];
 }
 
++ (instancetype)alertControllerWithTitle:(nullable NSString *)title message:(nullable NSString *)message {
+    return [[self alloc] initWithTitle:title message:message];
+}
+
 - (instancetype)initWithContentController:(__kindof UIViewController *)contentController {
     self = [super initWithNibName:nil bundle:nil];
     if (self) {
         _contentController = contentController;
 
-        self.modalPresentationStyle = UIModalPresentationCustom;
-        self.transitioningDelegate = self;
-        self.actions = @[];
+        [self setupAlertController];
 
         [self displayViewController:contentController];
     }
     return self;
 }
 
+- (instancetype)initWithTitle:(nullable NSString *)title message:(nullable NSString *)message {
+    self = [super initWithNibName:nil bundle:nil];
+    if (self) {
+        _hasTitleMessageContent = YES;
+
+        [self setupAlertController];
+
+        [self.alertView setupTitle:title message:message];
+    }
+    return self;
+}
+
 - (instancetype)init {
     @throw [NSException exceptionWithName:NSInternalInconsistencyException
                                    reason:@"-init is not a valid initializer for the class DWAlertController. Use -initWithContentController: instead."
@@ -82,7 +119,8 @@ NS_ASSUME_NONNULL_BEGIN
         alertView.delegate = self;
         [self.view addSubview:alertView];
 
-        CGFloat maximumAllowedViewHeight = [self maximumAllowedAlertHeightWithKeyboard:0.0];
+        [self updateGeometryContainerWithSize:self.view.bounds.size window:self.view.window];
+        const CGFloat maximumAllowedViewHeight = [self maximumAllowedAlertHeightWithKeyboard:0.0];
         [NSLayoutConstraint activateConstraints:@[
             [alertView.centerXAnchor constraintEqualToAnchor:self.view.centerXAnchor],
             (self.alertViewCenterYConstraint = [alertView.centerYAnchor constraintEqualToAnchor:self.view.centerYAnchor]),
@@ -97,9 +135,21 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)viewWillAppear:(BOOL)animated {
     [super viewWillAppear:animated];
 
-    NSAssert(self.contentController, @"Alert must be configured with a content controller");
+    NSAssert(self.contentController || self.hasTitleMessageContent,
+             @"Alert must be configured with a content controller or title and message");
 
     [self dw_startObservingKeyboardNotifications];
+
+    // the view isn't in the window yet, but the presenter's window is the one the alert is shown in
+    UIWindow *window = self.view.window ?: self.presentingViewController.view.window;
+    [self updateGeometryContainerWithSize:self.view.bounds.size window:window];
+    self.alertViewHeightConstraint.constant = [self maximumAllowedAlertHeightWithKeyboard:self.dw_keyboardHeight];
+}
+
+- (void)viewDidAppear:(BOOL)animated {
+    [super viewDidAppear:animated];
+
+    [self performPendingReplacementIfNeeded];
 }
 
 - (void)viewWillDisappear:(BOOL)animated {
@@ -109,6 +159,17 @@ NS_ASSUME_NONNULL_BEGIN
     [self.view endEditing:YES];
 }
 
+- (void)viewDidDisappear:(BOOL)animated {
+    [super viewDidDisappear:animated];
+
+    [self performPendingReplacementIfNeeded];
+
+    if (self.presentedInOverlayWindow && self.isBeingDismissed) {
+        self.presentedInOverlayWindow = NO;
+        [[DWAlertOverlayWindow sharedWindow] hideIfNeeded];
+    }
+}
+
 - (void)viewDidLayoutSubviews {
     [super viewDidLayoutSubviews];
 
@@ -120,12 +181,16 @@ NS_ASSUME_NONNULL_BEGIN
 
     [coordinator
         animateAlongsideTransition:^(id<UIViewControllerTransitionCoordinatorContext> context) {
-            const CGFloat maximumAllowedViewHeight =
-                [self maximumAllowedAlertHeightWithKeyboard:self.dw_keyboardHeight];
-
-            self.alertViewHeightConstraint.constant = maximumAllowedViewHeight;
-            [self.alertView setNeedsLayout];
-            [self.alertView layoutIfNeeded];
+            // safe area insets of the window are already updated for the new size at this point
+            [self updateGeometryContainerWithSize:size window:context.containerView.window ?: self.view.window];
+            const CGFloat maximumAllowedViewHeight = [self maximumAllowedAlertHeightWithKeyboard:self.dw_keyboardHeight];
+
+            // During live resizing the same sizes come over and over again, skip the layout if nothing changed
+            if (self.alertViewHeightConstraint.constant != maximumAllowedViewHeight) {
+                self.alertViewHeightConstraint.constant = maximumAllowedViewHeight;
+                [self.alertView setNeedsLayout];
+                [self.alertView layoutIfNeeded];
+            }
             [self.alertView resetActionsState];
         }
                         completion:nil];
@@ -143,6 +208,63 @@ NS_ASSUME_NONNULL_BEGIN
     self.contentController = controller;
 }
 
+- (void)prepareForPresentationWithCompletion:(void (^__nullable)(void))completion {
+    [self.alertView measureTextsWithCompletion:completion];
+}
+
+- (void)showAnimated:(BOOL)animated completion:(void (^__nullable)(void))completion {
+    if (![NSThread isMainThread]) {
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [self showAnimated:animated completion:completion];
+        });
+
+        return;
+    }
+
+    NSAssert(self.presentingViewController == nil, @"Alert is already presented");
+
+    self.presentedInOverlayWindow = YES;
+    [[DWAlertOverlayWindow sharedWindow] presentAlertController:self animated:animated completion:completion];
+}
+
+- (void)replaceWithAlertController:(DWAlertController *)alertController completion:(void (^__nullable)(void))completion {
+    NSParameterAssert(alertController);
+
+    UIViewController *presentingViewController = self.presentingViewController;
+    NSAssert(presentingViewController, @"Alert must be presented to be replaced");
+
+    DWAlertPresentationController *presentationController = self.alertPresentationController;
+    DWDimmingView *dimmingView = presentationController.dimmingView;
+    presentationController.keepsDimmingViewOnDismissal = YES;
+    alertController.handOffDimmingView = dimmingView;
+    alertController.presentedInOverlayWindow = self.presentedInOverlayWindow;
+
+    void (^presentAlertController)(void) = ^{
+        [presentingViewController presentViewController:alertController animated:YES completion:completion];
+
+        if (alertController.presentingViewController == nil) {
+            // presentation has failed, don't leave the dimming on screen
+            alertController.handOffDimmingView = nil;
+            [dimmingView removeFromSuperview];
+        }
+    };
+
+    if (self.isBeingDismissed) {
+        self.pendingReplacementBlock = presentAlertController;
+        // don't run the dismissal to its end: the dimming would drop to 0 before the next alert shows it again
+        [self.transitionAnimationController completeTransitionInCurrentState];
+    }
+    else if (self.isBeingPresented) {
+        self.pendingReplacementBlock = ^{
+            [presentingViewController dismissViewControllerAnimated:NO completion:presentAlertController];
+        };
+        [self.transitionAnimationController finishTransitionImmediately];
+    }
+    else {
+        [presentingViewController dismissViewControllerAnimated:NO completion:presentAlertController];
+    }
+}
+
 - (void)addAction:(DWAlertAction *)action {
     NSParameterAssert(action);
 
@@ -167,6 +289,10 @@ NS_ASSUME_NONNULL_BEGIN
 }
 
 - (void)setupActions:(NSArray<DWAlertAction *> *)actions {
+    [self setupActions:actions animated:NO];
+}
+
+- (void)setupActions:(NSArray<DWAlertAction *> *)actions animated:(BOOL)animated {
     NSParameterAssert(actions);
 
 #ifdef DEBUG
@@ -179,16 +305,25 @@ NS_ASSUME_NONNULL_BEGIN
     }
 #endif
 
-    [self.alertView removeAllActions];
-
     self.actions = actions;
 
-    for (DWAlertAction *action in actions) {
-        [self.alertView addAction:action];
-    }
+    [self.alertView setupActions:actions];
 
     [self.view setNeedsLayout];
-    [self.view layoutIfNeeded];
+    if (animated && self.view.window) {
+        [UIView animateWithDuration:DWAlertInplaceTransitionAnimationDuration
+                              delay:0.0
+             usingSpringWithDamping:DWAlertInplaceTransitionAnimationDampingRatio
+              initialSpringVelocity:DWAlertInplaceTransitionAnimationInitialVelocity
+                            options:DWAlertInplaceTransitionAnimationOptions
+                         animations:^{
+                             [self.view layoutIfNeeded];
+                         }
+                         completion:nil];
+    }
+    else {
+        [self.view layoutIfNeeded];
+    }
 }
 
 - (nullable DWAlertAction *)preferredAction {
@@ -209,26 +344,64 @@ NS_ASSUME_NONNULL_BEGIN
     self.alertPresentationController.appearanceMode = appearanceMode;
 }
 
-- (void)setNormalTintColor:(UIColor *)normalTintColor {
-    _normalTintColor = normalTintColor;
+- (BOOL)usesLightweightActionViews {
+    return self.alertView.actionViewClass == [DWAlertViewActionLayerView class];
+}
+
+- (void)setUsesLightweightActionViews:(BOOL)usesLightweightActionViews {
+    NSAssert(self.actions.count == 0, @"Action views class must be set before adding actions");
+
+    self.alertView.actionViewClass = usesLightweightActionViews ? [DWAlertViewActionLayerView class] : nil;
+}
+
+- (UIColor *)normalTintColor {
+    return self.alertView.normalTintColor;
+}
+
+- (void)setNormalTintColor:(nullable UIColor *)normalTintColor {
     self.alertView.normalTintColor = normalTintColor;
 }
 
-- (void)setDisabledTintColor:(UIColor *)disabledTintColor {
-    _disabledTintColor = disabledTintColor;
+- (UIColor *)disabledTintColor {
+    return self.alertView.disabledTintColor;
+}
+
+- (void)setDisabledTintColor:(nullable UIColor *)disabledTintColor {
     self.alertView.disabledTintColor = disabledTintColor;
 }
 
-- (void)setDestructiveTintColor:(UIColor *)destructiveTintColor {
-    _destructiveTintColor = destructiveTintColor;
+- (UIColor *)destructiveTintColor {
+    return self.alertView.destructiveTintColor;
+}
+
+- (void)setDestructiveTintColor:(nullable UIColor *)destructiveTintColor {
     self.alertView.destructiveTintColor = destructiveTintColor;
 }
 
 #pragma mark - DWAlertViewDelegate
 
 - (void)alertView:(DWAlertView *)alertView didAction:(DWAlertAction *)action {
-    if (action.handler) {
+    if (self.executingAction) {
+        return;
+    }
+
+    if (action.asyncHandler) {
+        [self performAsyncAction:action];
+    }
+    else if (action.handler) {
+        const CFTimeInterval startTime = CACurrentMediaTime();
+        os_signpost_id_t signpostID = 0;
+        if (@available(iOS 12.0, *)) {
+            signpostID = os_signpost_id_generate(DWAlertActionsLog());
+            os_signpost_interval_begin(DWAlertActionsLog(), signpostID, "Action Handler");
+        }
+
         action.handler(action);
+
+        if (@available(iOS 12.0, *)) {
+            os_signpost_interval_end(DWAlertActionsLog(), signpostID, "Action Handler");
+        }
+        action.lastHandlerDuration = CACurrentMediaTime() - startTime;
     }
     else {
         [self dismissViewControllerAnimated:YES completion:nil];
@@ -241,11 +414,13 @@ NS_ASSUME_NONNULL_BEGIN
                                                                            presentingController:(UIViewController *)presenting
                                                                                sourceController:(UIViewController *)source {
     DWAlertPresentationAnimationController *animationController = [[DWAlertPresentationAnimationController alloc] init];
+    self.transitionAnimationController = animationController;
     return animationController;
 }
 
 - (nullable id<UIViewControllerAnimatedTransitioning>)animationControllerForDismissedController:(UIViewController *)dismissed {
     DWAlertDismissalAnimationController *animationController = [[DWAlertDismissalAnimationController alloc] init];
+    self.transitionAnimationController = animationController;
     return animationController;
 }
 
@@ -253,6 +428,8 @@ NS_ASSUME_NONNULL_BEGIN
                                                                presentingViewController:(nullable UIViewController *)presenting
                                                                    sourceViewController:(UIViewController *)source {
     DWAlertPresentationController *presentationController = [[DWAlertPresentationController alloc] initWithPresentedViewController:presented presentingViewController:presenting];
+    presentationController.reusableDimmingView = self.handOffDimmingView;
+    self.handOffDimmingView = nil;
     self.alertPresentationController = presentationController;
     return presentationController;
 }
@@ -262,7 +439,7 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)dw_keyboardWillShowOrHideWithHeight:(CGFloat)height
                           animationDuration:(NSTimeInterval)animationDuration
                              animationCurve:(UIViewAnimationCurve)animationCurve {
-    CGFloat maximumAllowedViewHeight = [self maximumAllowedAlertHeightWithKeyboard:height];
+    const CGFloat maximumAllowedViewHeight = [self maximumAllowedAlertHeightWithKeyboard:height];
     self.alertViewHeightConstraint.constant = maximumAllowedViewHeight;
     self.alertViewCenterYConstraint.constant = -height / 2.0;
 }
@@ -310,6 +487,92 @@ NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark - Private
 
+- (void)setupAlertController {
+    self.modalPresentationStyle = UIModalPresentationCustom;
+    self.transitioningDelegate = self;
+    self.actions = @[];
+}
+
+- (void)performAsyncAction:(DWAlertAction *)action {
+    self.executingAction = action;
+    action.executing = YES;
+
+    // disable other actions while the handler is running,
+    // remember the state each of them is left in to tell it apart from changes made by the client
+    NSMapTable<DWAlertAction *, NSNumber *> *disabledActions = [NSMapTable strongToStrongObjectsMapTable];
+    for (DWAlertAction *otherAction in self.actions) {
+        if (otherAction != action && otherAction.enabled) {
+            otherAction.enabled = NO;
+            [disabledActions setObject:@(otherAction.enabledChangesCount) forKey:otherAction];
+        }
+    }
+
+    if (action.showsActivityIndicator) {
+        [self.alertView setActivityIndicatorVisible:YES forAction:action];
+    }
+
+    const CFTimeInterval startTime = CACurrentMediaTime();
+    os_signpost_id_t signpostID = 0;
+    if (@available(iOS 12.0, *)) {
+        signpostID = os_signpost_id_generate(DWAlertActionsLog());
+        os_signpost_interval_begin(DWAlertActionsLog(), signpostID, "Async Action Handler");
+    }
+
+    __block BOOL completed = NO;
+    __weak typeof(self) weakSelf = self;
+    dispatch_block_t completion = ^{
+        dispatch_async(dispatch_get_main_queue(), ^{
+            // completion is allowed to be called only once, ignore extra calls
+            if (completed) {
+                return;
+            }
+            completed = YES;
+
+            if (@available(iOS 12.0, *)) {
+                os_signpost_interval_end(DWAlertActionsLog(), signpostID, "Async Action Handler");
+            }
+            action.lastHandlerDuration = CACurrentMediaTime() - startTime;
+            action.executing = NO;
+
+            for (DWAlertAction *disabledAction in disabledActions) {
+                // enabled state changed while the handler was running is left as is
+                const NSUInteger changesCount = [disabledActions objectForKey:disabledAction].unsignedIntegerValue;
+                if (disabledAction.enabledChangesCount == changesCount) {
+                    disabledAction.enabled = YES;
+                }
+            }
+
+            __strong typeof(weakSelf) strongSelf = weakSelf;
+            if (!strongSelf) {
+                return;
+            }
+
+            [strongSelf.alertView setActivityIndicatorVisible:NO forAction:action];
+            strongSelf.executingAction = nil;
+
+            if (strongSelf.presentingViewController && !strongSelf.isBeingDismissed) {
+                [strongSelf dismissViewControllerAnimated:YES completion:nil];
+            }
+        });
+    };
+
+    DWAlertActionAsyncHandler asyncHandler = action.asyncHandler;
+    dispatch_async(action.handlerQueue, ^{
+        asyncHandler(action, completion);
+    });
+}
+
+- (void)performPendingReplacementIfNeeded {
+    void (^pendingReplacementBlock)(void) = self.pendingReplacementBlock;
+    if (!pendingReplacementBlock) {
+        return;
+    }
+    self.pendingReplacementBlock = nil;
+
+    // let UIKit finish the current transition first
+    dispatch_async(dispatch_get_main_queue(), pendingReplacementBlock);
+}
+
 - (void)updateDimmedViewVisiblePath {
     DWAlertPresentationController *presentationController = (DWAlertPresentationController *)self.presentationController;
     if ([presentationController isKindOfClass:DWAlertPresentationController.class]) {
@@ -370,23 +633,38 @@ NS_ASSUME_NONNULL_BEGIN
         }];
 }
 
-- (CGFloat)maximumAllowedAlertHeightWithKeyboard:(CGFloat)keyboardHeight {
-    CGFloat minInset;
+- (void)updateGeometryContainerWithSize:(CGSize)containerSize window:(nullable UIWindow *)window {
+    UIEdgeInsets insets = UIEdgeInsetsZero;
     if (@available(iOS 11.0, *)) {
-        UIEdgeInsets insets = [UIApplication sharedApplication].delegate.window.safeAreaInsets;
-        minInset = MAX(insets.top, insets.bottom);
+        insets = window.safeAreaInsets;
     }
     else {
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdeprecated-declarations"
-        minInset = MAX(self.topLayoutGuide.length, self.bottomLayoutGuide.length);
+        insets = UIEdgeInsetsMake(self.topLayoutGuide.length, 0.0, self.bottomLayoutGuide.length, 0.0);
 #pragma clang diagnostic pop
     }
 
-    CGFloat padding = DWAlertViewVerticalPadding(minInset, keyboardHeight > 0.0);
-    CGFloat height = CGRectGetHeight([UIScreen mainScreen].bounds) - padding * 2.0 - keyboardHeight;
+    if (CGSizeEqualToSize(containerSize, CGSizeZero)) {
+        containerSize = window ? window.bounds.size : [UIScreen mainScreen].bounds.size;
+    }
+
+    UITraitCollection *traitCollection = window ? window.traitCollection : self.traitCollection;
 
-    return height;
+    DWAlertGeometryContainer container;
+    container.width = containerSize.width;
+    container.height = containerSize.height;
+    container.topInset = insets.top;
+    container.bottomInset = insets.bottom;
+    container.keyboardHeight = 0.0;
+    container.isPad = traitCollection.userInterfaceIdiom == UIUserInterfaceIdiomPad;
+    self.geometryContainer = container;
+}
+
+- (CGFloat)maximumAllowedAlertHeightWithKeyboard:(CGFloat)keyboardHeight {
+    DWAlertGeometryContainer container = self.geometryContainer;
+    container.keyboardHeight = keyboardHeight;
+    return DWAlertGeometryMaximumAlertHeight(container);
 }
 
 @end
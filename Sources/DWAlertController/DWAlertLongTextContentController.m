@@ -0,0 +1,107 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "DWAlertController/DWAlertLongTextContentController.h"
+
+#import "Private/DWAlertLongTextView.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface DWAlertLongTextContentController ()
+
+@property (null_resettable, nonatomic, strong) DWAlertLongTextView *view;
+/// Plain text the attributed text is built from, nil if the attributed text is provided by the client
+@property (nullable, nonatomic, copy) NSString *plainText;
+
+@end
+
+@implementation DWAlertLongTextContentController
+
+@dynamic view;
+
+- (instancetype)initWithAttributedText:(NSAttributedString *)attributedText {
+    self = [super initWithNibName:nil bundle:nil];
+    if (self) {
+        _attributedText = [attributedText copy];
+    }
+    return self;
+}
+
+- (instancetype)initWithText:(NSString *)text {
+    self = [self initWithAttributedText:[self.class attributedTextWithText:text]];
+    if (self) {
+        _plainText = [text copy];
+
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(contentSizeCategoryDidChangeNotification:)
+                                                     name:UIContentSizeCategoryDidChangeNotification
+                                                   object:nil];
+    }
+    return self;
+}
+
+- (void)loadView {
+    self.view = [[DWAlertLongTextView alloc] initWithAttributedText:self.attributedText];
+}
+
+- (void)setAttributedText:(NSAttributedString *)attributedText {
+    self.plainText = nil;
+
+    [self updateAttributedText:attributedText];
+}
+
+#pragma mark - Notifications
+
+- (void)contentSizeCategoryDidChangeNotification:(NSNotification *)notification {
+    NSString *plainText = self.plainText;
+    if (!plainText) {
+        return;
+    }
+
+    // rebuilds the text storage and re-estimates the height with the new font
+    [self updateAttributedText:[self.class attributedTextWithText:plainText]];
+}
+
+#pragma mark - Private
+
++ (NSAttributedString *)attributedTextWithText:(NSString *)text {
+    UIColor *textColor = nil;
+    if (@available(iOS 13.0, *)) {
+        textColor = [UIColor labelColor];
+    }
+    else {
+        textColor = [UIColor blackColor];
+    }
+    NSDictionary<NSAttributedStringKey, id> *attributes = @{
+        NSFontAttributeName : [UIFont preferredFontForTextStyle:UIFontTextStyleBody],
+        NSForegroundColorAttributeName : textColor,
+    };
+
+    return [[NSAttributedString alloc] initWithString:text attributes:attributes];
+}
+
+- (void)updateAttributedText:(NSAttributedString *)attributedText {
+    _attributedText = [attributedText copy];
+
+    if (self.isViewLoaded) {
+        self.view.attributedText = attributedText;
+    }
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
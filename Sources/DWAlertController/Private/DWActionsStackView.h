@@ -22,6 +22,7 @@
 NS_ASSUME_NONNULL_BEGIN
 
 @class DWActionsStackView;
+@class DWAlertMeasurement;
 
 @protocol DWActionsStackViewDelegate <NSObject>
 
@@ -40,9 +41,21 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nullable, weak, nonatomic) id<DWActionsStackViewDelegate> delegate;
 @property (nullable, strong, nonatomic) DWAlertAction *preferredAction;
 
+/**
+ Action title widths measured in advance to avoid measuring the buttons when choosing the axis.
+ Setting this property updates the layout.
+ */
+@property (nullable, strong, nonatomic) DWAlertMeasurement *measurement;
+
 - (void)addActionButton:(DWAlertViewActionBaseView *)button;
+
+/**
+ Replaces arranged buttons with the given ones.
+ Buttons that are already arranged are moved if needed but not recreated, the rest are removed.
+ Layout is updated once.
+ */
+- (void)setActionButtons:(NSArray<DWAlertViewActionBaseView *> *)buttons;
 - (void)resetActionsState;
-- (void)removeAllActions;
 
 - (instancetype)initWithCoder:(NSCoder *)coder NS_UNAVAILABLE;
 - (instancetype)initWithArrangedSubviews:(NSArray<__kindof UIView *> *)views NS_UNAVAILABLE;
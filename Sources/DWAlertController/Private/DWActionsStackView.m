@@ -18,6 +18,7 @@
 #import "DWActionsStackView.h"
 
 #import "DWAlertInternalConstants.h"
+#import "DWAlertMeasurement.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -62,27 +63,64 @@ NS_ASSUME_NONNULL_BEGIN
     [self updateButtonsLayout];
 }
 
-- (void)resetActionsState {
-    [self resetHighlightedButton];
-}
-
-- (void)setPreferredAction:(nullable DWAlertAction *)preferredAction {
-    _preferredAction = preferredAction;
-    [self updatePreferredAction];
-}
-
-- (void)removeAllActions {
-    [self resetHighlightedButton];
+- (void)setActionButtons:(NSArray<DWAlertViewActionBaseView *> *)buttons {
+    NSSet<DWAlertViewActionBaseView *> *buttonsSet = [NSSet setWithArray:buttons];
+    for (DWAlertViewActionBaseView *button in [self.arrangedSubviews copy]) {
+        if ([buttonsSet containsObject:button]) {
+            continue;
+        }
 
-    NSArray<DWAlertViewActionBaseView *> *actions = [self.arrangedSubviews copy];
-    for (DWAlertViewActionBaseView *button in actions) {
+        if (button == self.highlightedButton) {
+            [self resetHighlightedButton];
+        }
         button.delegate = nil;
         [self removeArrangedSubview:button];
         [button removeFromSuperview];
     }
 
-    _preferredAction = nil;
     self.cancelButton = nil;
+    DWAlertAction *preferredAction = self.preferredAction;
+    DWAlertAction *updatedPreferredAction = nil;
+    NSUInteger index = 0;
+    for (DWAlertViewActionBaseView *button in buttons) {
+        NSAssert([button isKindOfClass:DWAlertViewActionBaseView.class], @"Invalid button type");
+
+        button.delegate = self;
+        DWAlertAction *action = button.alertAction;
+        if (action.style == DWAlertActionStyleCancel) {
+            self.cancelButton = button;
+        }
+        if (preferredAction &&
+            (action == preferredAction ||
+             (preferredAction.identifier && [action.identifier isEqualToString:preferredAction.identifier]))) {
+            updatedPreferredAction = action;
+        }
+
+        NSArray<DWAlertViewActionBaseView *> *arrangedSubviews = self.arrangedSubviews;
+        if (index >= arrangedSubviews.count || arrangedSubviews[index] != button) {
+            // moves the button if it's already arranged
+            [self insertArrangedSubview:button atIndex:index];
+        }
+        index += 1;
+    }
+
+    _preferredAction = updatedPreferredAction;
+    [self updatePreferredAction];
+    [self updateButtonsLayout];
+}
+
+- (void)setMeasurement:(nullable DWAlertMeasurement *)measurement {
+    _measurement = measurement;
+    [self updateButtonsLayout];
+}
+
+- (void)resetActionsState {
+    [self resetHighlightedButton];
+}
+
+- (void)setPreferredAction:(nullable DWAlertAction *)preferredAction {
+    _preferredAction = preferredAction;
+    [self updatePreferredAction];
 }
 
 #pragma mark - DWAlertViewActionButtonDelegate
@@ -151,41 +189,42 @@ NS_ASSUME_NONNULL_BEGIN
 }
 
 - (void)updatePreferredAction {
-    if (!self.preferredAction) {
-        self.cancelButton.preferred = YES;
-
-        return;
-    }
-
+    // buttons might be reused, so reset the state of all of them
+    DWAlertAction *preferredAction = self.preferredAction;
     for (DWAlertViewActionBaseView *button in self.arrangedSubviews) {
-        button.preferred = (button.alertAction == self.preferredAction);
+        if (preferredAction) {
+            button.preferred = (button.alertAction == preferredAction);
+        }
+        else {
+            button.preferred = (button == self.cancelButton);
+        }
     }
 }
 
 - (void)updateButtonsLayout {
     NSArray<DWAlertViewActionBaseView *> *buttons = self.arrangedSubviews;
     const NSUInteger buttonsCount = buttons.count;
-    if (buttonsCount < 2) {
-        self.axis = UILayoutConstraintAxisHorizontal;
-    }
-    else if (buttonsCount == 2) {
-        BOOL shouldBeVertical = NO;
-        // only 2 horizontal buttons are allowed
-        const CGFloat actionWidth = DWAlertViewWidth / 2.0 - DWAlertViewSeparatorSize();
-        for (UIView *button in buttons) {
-            const CGSize size = [button systemLayoutSizeFittingSize:UILayoutFittingCompressedSize];
-            if (size.width > actionWidth) {
-                shouldBeVertical = YES;
-                break;
+    // titles are measured only when it matters: for exactly 2 buttons
+    double titleWidths[2] = {0.0, 0.0};
+    if (buttonsCount == 2) {
+        DWAlertMeasurement *measurement = self.measurement.isValidForCurrentEnvironment ? self.measurement : nil;
+        for (NSUInteger i = 0; i < buttonsCount; i++) {
+            DWAlertViewActionBaseView *button = buttons[i];
+            CGFloat width = 0.0;
+            NSString *title = button.alertAction.title ?: @"";
+            if (![measurement getWidth:&width forActionTitle:title preferred:button.preferred]) {
+                width = [button systemLayoutSizeFittingSize:UILayoutFittingCompressedSize].width;
             }
+            titleWidths[i] = width;
         }
-
-        self.axis = shouldBeVertical ? UILayoutConstraintAxisVertical : UILayoutConstraintAxisHorizontal;
-    }
-    else {
-        self.axis = UILayoutConstraintAxisVertical;
     }
 
+    const DWAlertGeometryAxis axis = DWAlertGeometryActionsAxis(titleWidths,
+                                                                buttonsCount,
+                                                                DWAlertViewWidth,
+                                                                DWAlertViewSeparatorSize());
+    self.axis = axis == DWAlertGeometryAxisVertical ? UILayoutConstraintAxisVertical : UILayoutConstraintAxisHorizontal;
+
     DWAlertViewActionBaseView *cancelButton = self.cancelButton;
     if (cancelButton && buttons.count > 1) {
         if (self.axis == UILayoutConstraintAxisHorizontal) {
@@ -22,6 +22,11 @@ NS_ASSUME_NONNULL_BEGIN
 @interface DWAlertAction ()
 
 @property (nullable, copy, nonatomic) void (^handler)(DWAlertAction *action);
+@property (nullable, copy, nonatomic) DWAlertActionAsyncHandler asyncHandler;
+@property (assign, nonatomic, getter=isExecuting) BOOL executing;
+@property (assign, nonatomic) NSTimeInterval lastHandlerDuration;
+/// Incremented on every change of `enabled`, tells whether the state was changed by the client in the meantime
+@property (readonly, assign, nonatomic) NSUInteger enabledChangesCount;
 
 @end
 
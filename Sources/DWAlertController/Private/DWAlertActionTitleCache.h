@@ -0,0 +1,50 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Process-wide cache of pre-rendered single line action titles.
+ The same titles ("OK", "Cancel") appear in most of the alerts, so they are typeset and drawn only once
+ per font, color and scale.
+ */
+@interface DWAlertActionTitleCache : NSObject
+
++ (instancetype)sharedCache;
+
+/**
+ Size of the title drawn in a single line without truncation
+ */
+- (CGSize)sizeForTitle:(NSString *)title font:(UIFont *)font;
+
+/**
+ Rendered title image.
+
+ @param maxWidth If the title doesn't fit into it, the title is truncated in the middle.
+ Pass 0 to render the title without truncation.
+ */
+- (UIImage *)imageForTitle:(NSString *)title
+                      font:(UIFont *)font
+                     color:(UIColor *)color
+                     scale:(CGFloat)scale
+                  maxWidth:(CGFloat)maxWidth;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,184 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "DWAlertActionTitleCache.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+static NSUInteger const ImagesCountLimit = 128;
+static NSUInteger const SizesCountLimit = 256;
+
+#pragma mark - Key
+
+@interface DWAlertActionTitleCacheKey : NSObject <NSCopying>
+
+@property (readonly, copy, nonatomic) NSString *title;
+@property (readonly, strong, nonatomic) UIFont *font;
+@property (nullable, readonly, strong, nonatomic) UIColor *color;
+@property (readonly, assign, nonatomic) CGFloat scale;
+@property (readonly, assign, nonatomic) CGFloat maxWidth;
+
+@end
+
+@implementation DWAlertActionTitleCacheKey
+
+- (instancetype)initWithTitle:(NSString *)title
+                         font:(UIFont *)font
+                        color:(nullable UIColor *)color
+                        scale:(CGFloat)scale
+                     maxWidth:(CGFloat)maxWidth {
+    self = [super init];
+    if (self) {
+        _title = [title copy];
+        _font = font;
+        _color = color;
+        _scale = scale;
+        _maxWidth = maxWidth;
+    }
+    return self;
+}
+
+- (id)copyWithZone:(nullable NSZone *)zone {
+    return self; // immutable
+}
+
+- (BOOL)isEqual:(id)object {
+    if (self == object) {
+        return YES;
+    }
+
+    if (![object isKindOfClass:DWAlertActionTitleCacheKey.class]) {
+        return NO;
+    }
+
+    DWAlertActionTitleCacheKey *other = object;
+    return [self.title isEqualToString:other.title] &&
+           [self.font isEqual:other.font] &&
+           (self.color == other.color || [self.color isEqual:other.color]) &&
+           self.scale == other.scale &&
+           self.maxWidth == other.maxWidth;
+}
+
+- (NSUInteger)hash {
+    return self.title.hash ^
+           self.font.hash ^
+           self.color.hash ^
+           ((NSUInteger)self.scale << 8) ^
+           ((NSUInteger)self.maxWidth << 16);
+}
+
+@end
+
+#pragma mark - Cache
+
+@interface DWAlertActionTitleCache ()
+
+@property (readonly, strong, nonatomic) NSCache<DWAlertActionTitleCacheKey *, UIImage *> *images;
+@property (readonly, strong, nonatomic) NSCache<DWAlertActionTitleCacheKey *, NSValue *> *sizes;
+
+@end
+
+@implementation DWAlertActionTitleCache
+
++ (instancetype)sharedCache {
+    static DWAlertActionTitleCache *sharedCache = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedCache = [[self alloc] init];
+    });
+    return sharedCache;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _images = [[NSCache alloc] init];
+        _images.countLimit = ImagesCountLimit;
+
+        _sizes = [[NSCache alloc] init];
+        _sizes.countLimit = SizesCountLimit;
+    }
+    return self;
+}
+
+- (CGSize)sizeForTitle:(NSString *)title font:(UIFont *)font {
+    DWAlertActionTitleCacheKey *key = [[DWAlertActionTitleCacheKey alloc] initWithTitle:title
+                                                                                   font:font
+                                                                                  color:nil
+                                                                                  scale:0.0
+                                                                               maxWidth:0.0];
+    NSValue *value = [self.sizes objectForKey:key];
+    if (value) {
+        return value.CGSizeValue;
+    }
+
+    const CGSize textSize = [title sizeWithAttributes:@{NSFontAttributeName : font}];
+    const CGSize size = CGSizeMake(ceil(textSize.width), ceil(MAX(textSize.height, font.lineHeight)));
+    [self.sizes setObject:[NSValue valueWithCGSize:size] forKey:key];
+
+    return size;
+}
+
+- (UIImage *)imageForTitle:(NSString *)title
+                      font:(UIFont *)font
+                     color:(UIColor *)color
+                     scale:(CGFloat)scale
+                  maxWidth:(CGFloat)maxWidth {
+    NSParameterAssert(scale > 0.0);
+
+    DWAlertActionTitleCacheKey *key = [[DWAlertActionTitleCacheKey alloc] initWithTitle:title
+                                                                                   font:font
+                                                                                  color:color
+                                                                                  scale:scale
+                                                                               maxWidth:maxWidth];
+    UIImage *image = [self.images objectForKey:key];
+    if (image) {
+        return image;
+    }
+
+    CGSize size = [self sizeForTitle:title font:font];
+    if (maxWidth > 0.0) {
+        size.width = MIN(size.width, floor(maxWidth));
+    }
+
+    NSMutableParagraphStyle *paragraphStyle = [[NSMutableParagraphStyle alloc] init];
+    paragraphStyle.alignment = NSTextAlignmentCenter;
+    paragraphStyle.lineBreakMode = NSLineBreakByTruncatingMiddle;
+    NSDictionary<NSAttributedStringKey, id> *attributes = @{
+        NSFontAttributeName : font,
+        NSForegroundColorAttributeName : color,
+        NSParagraphStyleAttributeName : paragraphStyle,
+    };
+
+    UIGraphicsBeginImageContextWithOptions(size, NO, scale);
+    [title drawInRect:CGRectMake(0.0, 0.0, size.width, size.height) withAttributes:attributes];
+    image = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+
+    NSAssert(image, @"Failed to render title");
+    if (!image) {
+        return [[UIImage alloc] init];
+    }
+
+    [self.images setObject:image forKey:key];
+
+    return image;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,70 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class DWAlertPresentationController;
+
+/**
+ Base class of alert transitions.
+
+ On iOS 10 or higher the transition is driven by an interruptible `UIViewPropertyAnimator`.
+ If the animator finishes at the start position (reversed) the transition is cancelled.
+ */
+@interface DWAlertBaseAnimationController : NSObject <UIViewControllerAnimatedTransitioning>
+
+/**
+ Brings the running transition to its final state without waiting for the animation to complete.
+ Does nothing on iOS 9 or if the transition isn't running.
+ */
+- (void)finishTransitionImmediately;
+
+/**
+ Stops the running transition leaving animatable properties at their current (in-flight) values
+ and completes it successfully. Used when the next alert picks up the state of the interrupted transition.
+ Does nothing on iOS 9 or if the transition isn't running.
+ */
+- (void)completeTransitionInCurrentState;
+
+/**
+ Sets initial state of the transition, called right before animations start.
+ Override point for subclasses.
+ */
+- (void)prepareForTransition:(id<UIViewControllerContextTransitioning>)transitionContext;
+
+/**
+ Changes animatable properties to its final values, called inside an animation block.
+ Override point for subclasses.
+ */
+- (void)performAnimationsForTransition:(id<UIViewControllerContextTransitioning>)transitionContext;
+
+/**
+ Called when the transition is completed in its current state, right before the completion.
+ Override point for subclasses.
+ */
+- (void)prepareForCompletionInCurrentState:(id<UIViewControllerContextTransitioning>)transitionContext;
+
+/**
+ Returns the alert presentation controller of the controller if there is any
+ */
+- (nullable DWAlertPresentationController *)alertPresentationControllerForViewController:(UIViewController *)controller;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,138 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "DWAlertBaseAnimationController.h"
+
+#import "DWAlertInternalConstants.h"
+#import "DWAlertPresentationController.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface DWAlertBaseAnimationController ()
+
+@property (nullable, strong, nonatomic) id<UIViewImplicitlyAnimating> animator;
+@property (nullable, strong, nonatomic) id<UIViewControllerContextTransitioning> transitionContext;
+
+@end
+
+@implementation DWAlertBaseAnimationController
+
+- (void)animateTransition:(id<UIViewControllerContextTransitioning>)transitionContext {
+    if (@available(iOS 10.0, *)) {
+        [[self interruptibleAnimatorForTransition:transitionContext] startAnimation];
+    }
+    else {
+        [self prepareForTransition:transitionContext];
+
+        [UIView animateWithDuration:[self transitionDuration:transitionContext]
+            delay:0.0
+            usingSpringWithDamping:DWAlertTransitionAnimationDampingRatio
+            initialSpringVelocity:DWAlertTransitionAnimationInitialVelocity
+            options:DWAlertTransitionAnimationOptions
+            animations:^{
+                [self performAnimationsForTransition:transitionContext];
+            }
+            completion:^(BOOL finished) {
+                [transitionContext completeTransition:!transitionContext.transitionWasCancelled];
+            }];
+    }
+}
+
+- (id<UIViewImplicitlyAnimating>)interruptibleAnimatorForTransition:(id<UIViewControllerContextTransitioning>)transitionContext API_AVAILABLE(ios(10.0)) {
+    // UIKit may ask for the animator several times during the single transition
+    if (self.animator) {
+        return self.animator;
+    }
+
+    [self prepareForTransition:transitionContext];
+
+    const CGFloat velocity = DWAlertTransitionAnimationInitialVelocity;
+    UISpringTimingParameters *timingParameters =
+        [[UISpringTimingParameters alloc] initWithDampingRatio:DWAlertTransitionAnimationDampingRatio
+                                               initialVelocity:CGVectorMake(velocity, velocity)];
+    UIViewPropertyAnimator *animator =
+        [[UIViewPropertyAnimator alloc] initWithDuration:[self transitionDuration:transitionContext]
+                                        timingParameters:timingParameters];
+    [animator addAnimations:^{
+        [self performAnimationsForTransition:transitionContext];
+    }];
+    [animator addCompletion:^(UIViewAnimatingPosition finalPosition) {
+        self.animator = nil;
+        self.transitionContext = nil;
+
+        const BOOL completed = finalPosition == UIViewAnimatingPositionEnd &&
+                               !transitionContext.transitionWasCancelled;
+        [transitionContext completeTransition:completed];
+    }];
+    self.animator = animator;
+    self.transitionContext = transitionContext;
+
+    return animator;
+}
+
+- (NSTimeInterval)transitionDuration:(nullable id<UIViewControllerContextTransitioning>)transitionContext {
+    return DWAlertTransitionAnimationDuration;
+}
+
+- (void)finishTransitionImmediately {
+    if (@available(iOS 10.0, *)) {
+        id<UIViewImplicitlyAnimating> animator = self.animator;
+        if (animator.state == UIViewAnimatingStateActive) {
+            [animator stopAnimation:NO];
+            [animator finishAnimationAtPosition:UIViewAnimatingPositionEnd];
+        }
+    }
+}
+
+- (void)completeTransitionInCurrentState {
+    if (@available(iOS 10.0, *)) {
+        id<UIViewImplicitlyAnimating> animator = self.animator;
+        id<UIViewControllerContextTransitioning> transitionContext = self.transitionContext;
+        if (animator.state != UIViewAnimatingStateActive || !transitionContext) {
+            return;
+        }
+
+        // stopping without finishing sets the in-flight values as the final ones and skips completion blocks
+        [animator stopAnimation:YES];
+        self.animator = nil;
+        self.transitionContext = nil;
+
+        [self prepareForCompletionInCurrentState:transitionContext];
+        [transitionContext completeTransition:!transitionContext.transitionWasCancelled];
+    }
+}
+
+- (void)prepareForTransition:(id<UIViewControllerContextTransitioning>)transitionContext {
+}
+
+- (void)performAnimationsForTransition:(id<UIViewControllerContextTransitioning>)transitionContext {
+}
+
+- (void)prepareForCompletionInCurrentState:(id<UIViewControllerContextTransitioning>)transitionContext {
+}
+
+- (nullable DWAlertPresentationController *)alertPresentationControllerForViewController:(UIViewController *)controller {
+    UIPresentationController *presentationController = controller.presentationController;
+    if ([presentationController isKindOfClass:DWAlertPresentationController.class]) {
+        return (DWAlertPresentationController *)presentationController;
+    }
+    return nil;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
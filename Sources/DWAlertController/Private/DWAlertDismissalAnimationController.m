@@ -17,34 +17,41 @@
 
 #import "DWAlertDismissalAnimationController.h"
 
-#import "DWAlertInternalConstants.h"
+#import "DWAlertPresentationController.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
 @implementation DWAlertDismissalAnimationController
 
-- (void)animateTransition:(id<UIViewControllerContextTransitioning>)transitionContext {
+- (void)performAnimationsForTransition:(id<UIViewControllerContextTransitioning>)transitionContext {
     UIViewController *fromViewController =
         [transitionContext viewControllerForKey:UITransitionContextFromViewControllerKey];
     UIViewController *toViewController =
         [transitionContext viewControllerForKey:UITransitionContextToViewControllerKey];
 
-    [UIView animateWithDuration:[self transitionDuration:transitionContext]
-        delay:0.0
-        usingSpringWithDamping:DWAlertTransitionAnimationDampingRatio
-        initialSpringVelocity:DWAlertTransitionAnimationInitialVelocity
-        options:DWAlertTransitionAnimationOptions
-        animations:^{
-            toViewController.view.tintAdjustmentMode = UIViewTintAdjustmentModeAutomatic;
-            fromViewController.view.alpha = 0.0;
-        }
-        completion:^(BOOL finished) {
-            [transitionContext completeTransition:YES];
-        }];
+    fromViewController.view.alpha = 0.0;
+
+    // When the alert is being replaced with another one, the dimming is handed off to the next alert
+    DWAlertPresentationController *presentationController =
+        [self alertPresentationControllerForViewController:fromViewController];
+    if (!presentationController.keepsDimmingViewOnDismissal) {
+        toViewController.view.tintAdjustmentMode = UIViewTintAdjustmentModeAutomatic;
+        presentationController.dimmingView.alpha = 0.0;
+    }
 }
 
-- (NSTimeInterval)transitionDuration:(nullable id<UIViewControllerContextTransitioning>)transitionContext {
-    return DWAlertTransitionAnimationDuration;
+- (void)prepareForCompletionInCurrentState:(id<UIViewControllerContextTransitioning>)transitionContext {
+    UIViewController *fromViewController =
+        [transitionContext viewControllerForKey:UITransitionContextFromViewControllerKey];
+    UIViewController *toViewController =
+        [transitionContext viewControllerForKey:UITransitionContextToViewControllerKey];
+
+    // The alert is replaced in the middle of dismissal: the next alert keeps the presenter dimmed
+    DWAlertPresentationController *presentationController =
+        [self alertPresentationControllerForViewController:fromViewController];
+    if (presentationController.keepsDimmingViewOnDismissal) {
+        toViewController.view.tintAdjustmentMode = UIViewTintAdjustmentModeDimmed;
+    }
 }
 
 @end
@@ -0,0 +1,269 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "DWAlertGeometryCore.h"
+
+#include <math.h>
+
+static double const ActionButtonMinHeights[DWAlertGeometryContentSizeCategoryCount] = {
+    44.5,  // default
+    47.0,  // XL
+    49.5,  // XXL
+    51.5,  // XXXL
+    67.5,  // AX M
+    79.5,  // AX L
+    96.0,  // AX XL
+    112.5, // AX XXL
+    125.5, // AX XXXL
+};
+
+static double const ActionButtonTitlePaddings[DWAlertGeometryContentSizeCategoryCount] = {
+    12.0, // default
+    12.0, // XL
+    12.0, // XXL
+    12.0, // XXXL
+    16.0, // AX M
+    16.0, // AX L
+    16.0, // AX XL
+    16.0, // AX XXL
+    16.0, // AX XXXL
+};
+
+double DWAlertGeometryVerticalPadding(double minInset,
+                                      bool keyboardVisible,
+                                      bool isPad,
+                                      bool isPortrait,
+                                      bool hasTopNotch) {
+    double padding = 0.0;
+    if (isPad) {
+        if (keyboardVisible) {
+            padding = 20.0;
+        }
+        else {
+            padding = 24.0;
+        }
+    }
+    else {
+        if (isPortrait) {
+            if (keyboardVisible) {
+                padding = hasTopNotch ? minInset : 20.0;
+            }
+            else {
+                padding = hasTopNotch ? 61.0 : 24.0;
+            }
+        }
+        else {
+            padding = 8.0;
+        }
+    }
+
+    return fmax(padding, minInset);
+}
+
+double DWAlertGeometryMaximumAlertHeight(DWAlertGeometryContainer container) {
+    const double minInset = fmax(container.topInset, container.bottomInset);
+    const bool keyboardVisible = container.keyboardHeight > 0.0;
+    const bool isPortrait = container.height >= container.width;
+    const bool hasTopNotch = container.bottomInset > 0.0;
+
+    const double padding = DWAlertGeometryVerticalPadding(minInset,
+                                                          keyboardVisible,
+                                                          container.isPad,
+                                                          isPortrait,
+                                                          hasTopNotch);
+    return container.height - padding * 2.0 - container.keyboardHeight;
+}
+
+double DWAlertGeometryActionButtonMinHeight(DWAlertGeometryContentSizeCategory category) {
+    if (category >= DWAlertGeometryContentSizeCategoryCount) {
+        category = DWAlertGeometryContentSizeCategoryDefault;
+    }
+    return ActionButtonMinHeights[category];
+}
+
+double DWAlertGeometryActionButtonTitlePadding(DWAlertGeometryContentSizeCategory category) {
+    if (category >= DWAlertGeometryContentSizeCategoryCount) {
+        category = DWAlertGeometryContentSizeCategoryDefault;
+    }
+    return ActionButtonTitlePaddings[category];
+}
+
+DWAlertGeometryLayout DWAlertGeometryLayoutAlert(DWAlertGeometryLayoutInput input) {
+    const double maxHeight = input.maxHeight;
+    const double contentHeight = input.contentHeight;
+    const double actionsHeight = input.actionsHeight;
+    const double separatorSize = input.separatorSize;
+
+    // actions lower than the minimum (a single button) don't need the whole minimum reserved
+    const double actionsMinimumHeight = fmin(actionsHeight, input.actionsMinimumHeight);
+    double maxContentHeight = maxHeight;
+    if (input.hasActions) {
+        maxContentHeight -= actionsMinimumHeight;
+    }
+
+    double leftOverForActions;
+    double contentScrollHeight;
+    if (contentHeight < maxContentHeight) {
+        contentScrollHeight = contentHeight;
+        leftOverForActions = maxHeight - contentHeight - separatorSize;
+    }
+    else {
+        contentScrollHeight = maxContentHeight;
+        if (input.hasActions) {
+            contentScrollHeight -= separatorSize;
+        }
+        leftOverForActions = maxHeight - contentHeight;
+    }
+
+    DWAlertGeometryLayout layout;
+    // there might be no room for the content at all if the actions take all the height
+    layout.contentScrollHeight = fmax(contentScrollHeight, 0.0);
+    layout.actionsScrollHeight = fmax(actionsMinimumHeight, fmin(actionsHeight, leftOverForActions));
+    return layout;
+}
+
+DWAlertGeometryAxis DWAlertGeometryActionsAxis(const double *titleWidths,
+                                               size_t count,
+                                               double alertWidth,
+                                               double separatorSize) {
+    if (count < 2) {
+        return DWAlertGeometryAxisHorizontal;
+    }
+
+    if (count > 2) {
+        return DWAlertGeometryAxisVertical;
+    }
+
+    const double actionWidth = alertWidth / 2.0 - separatorSize;
+    for (size_t i = 0; i < count; i++) {
+        if (titleWidths[i] > actionWidth) {
+            return DWAlertGeometryAxisVertical;
+        }
+    }
+
+    return DWAlertGeometryAxisHorizontal;
+}
+
+double DWAlertGeometryActionsHeight(size_t count,
+                                    DWAlertGeometryAxis axis,
+                                    double buttonHeight,
+                                    double separatorSize) {
+    if (axis == DWAlertGeometryAxisHorizontal) {
+        return buttonHeight;
+    }
+
+    if (count == 0) {
+        return 0.0;
+    }
+
+    return (double)count * buttonHeight + (double)(count - 1) * separatorSize;
+}
+
+DWAlertGeometryRect DWAlertGeometrySeparatorRect(size_t index,
+                                                 size_t actionsCount,
+                                                 DWAlertGeometryAxis axis,
+                                                 double width,
+                                                 double buttonHeight,
+                                                 double separatorSize) {
+    DWAlertGeometryRect rect;
+    if (axis == DWAlertGeometryAxisHorizontal) {
+        const double separatorsCount = actionsCount > 0 ? (double)(actionsCount - 1) : 0.0;
+        const double distance = width / (double)actionsCount - separatorSize * separatorsCount;
+        rect.x = distance + (double)index * (distance + separatorSize);
+        rect.y = 0.0;
+        rect.width = separatorSize;
+        rect.height = buttonHeight;
+    }
+    else {
+        rect.x = 0.0;
+        rect.y = buttonHeight + (double)index * (buttonHeight + separatorSize);
+        rect.width = width;
+        rect.height = separatorSize;
+    }
+    return rect;
+}
+
+DWAlertGeometryRange DWAlertGeometrySeparatorsInRect(DWAlertGeometryRect rect,
+                                                     size_t actionsCount,
+                                                     DWAlertGeometryAxis axis,
+                                                     double width,
+                                                     double buttonHeight,
+                                                     double separatorSize) {
+    DWAlertGeometryRange range = {0, 0};
+    if (actionsCount < 2) {
+        return range;
+    }
+
+    const size_t separatorsCount = actionsCount - 1;
+
+#define SEPARATOR_INTERSECTS(i)                                                                    \
+    DWAlertGeometryRectIntersectsRect(rect, DWAlertGeometrySeparatorRect((i), actionsCount, axis, \
+                                                                         width, buttonHeight,      \
+                                                                         separatorSize))
+
+    size_t first = 0;
+    size_t end = separatorsCount;
+    const double step = buttonHeight + separatorSize;
+    if (axis == DWAlertGeometryAxisVertical && step > 0.0) {
+        // estimate the bounds arithmetically and fix rounding errors by checking the neighbours
+        const double firstEstimate = floor((rect.y - buttonHeight) / step);
+        first = firstEstimate > 0.0 ? (size_t)fmin(firstEstimate, (double)separatorsCount) : 0;
+        while (first > 0 && SEPARATOR_INTERSECTS(first - 1)) {
+            first--;
+        }
+
+        const double endEstimate = ceil((rect.y + rect.height - buttonHeight) / step);
+        end = endEstimate > 0.0 ? (size_t)fmin(endEstimate, (double)separatorsCount) : 0;
+        if (end < first) {
+            end = first;
+        }
+        while (end < separatorsCount && SEPARATOR_INTERSECTS(end)) {
+            end++;
+        }
+    }
+
+    while (first < end && !SEPARATOR_INTERSECTS(first)) {
+        first++;
+    }
+    while (end > first && !SEPARATOR_INTERSECTS(end - 1)) {
+        end--;
+    }
+
+#undef SEPARATOR_INTERSECTS
+
+    range.location = first;
+    range.length = end - first;
+    return range;
+}
+
+bool DWAlertGeometryRectIntersectsRect(DWAlertGeometryRect rect1, DWAlertGeometryRect rect2) {
+    return rect1.x < rect2.x + rect2.width &&
+           rect2.x < rect1.x + rect1.width &&
+           rect1.y < rect2.y + rect2.height &&
+           rect2.y < rect1.y + rect1.height;
+}
+
+bool DWAlertGeometryRectContainsRect(DWAlertGeometryRect rect1, DWAlertGeometryRect rect2) {
+    if (rect1.width <= 0.0 || rect1.height <= 0.0) {
+        return false;
+    }
+
+    return rect2.x >= rect1.x &&
+           rect2.y >= rect1.y &&
+           rect2.x + rect2.width <= rect1.x + rect1.width &&
+           rect2.y + rect2.height <= rect1.y + rect1.height;
+}
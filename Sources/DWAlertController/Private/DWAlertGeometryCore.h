@@ -0,0 +1,162 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#ifndef DWAlertGeometryCore_h
+#define DWAlertGeometryCore_h
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ Sizing rules of the alert as pure functions of explicit inputs.
+ Has no UIKit dependencies so it can be tested and benchmarked on any platform.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct DWAlertGeometryRect {
+    double x;
+    double y;
+    double width;
+    double height;
+} DWAlertGeometryRect;
+
+typedef struct DWAlertGeometryRange {
+    size_t location;
+    size_t length;
+} DWAlertGeometryRange;
+
+typedef enum DWAlertGeometryAxis {
+    DWAlertGeometryAxisHorizontal,
+    DWAlertGeometryAxisVertical,
+} DWAlertGeometryAxis;
+
+/**
+ Content size categories distinguished by the alert metrics.
+ Extra small, small, medium, large and unspecified categories share the default metrics.
+ */
+typedef enum DWAlertGeometryContentSizeCategory {
+    DWAlertGeometryContentSizeCategoryDefault,
+    DWAlertGeometryContentSizeCategoryExtraLarge,
+    DWAlertGeometryContentSizeCategoryExtraExtraLarge,
+    DWAlertGeometryContentSizeCategoryExtraExtraExtraLarge,
+    DWAlertGeometryContentSizeCategoryAccessibilityMedium,
+    DWAlertGeometryContentSizeCategoryAccessibilityLarge,
+    DWAlertGeometryContentSizeCategoryAccessibilityExtraLarge,
+    DWAlertGeometryContentSizeCategoryAccessibilityExtraExtraLarge,
+    DWAlertGeometryContentSizeCategoryAccessibilityExtraExtraExtraLarge,
+    DWAlertGeometryContentSizeCategoryCount,
+} DWAlertGeometryContentSizeCategory;
+
+/**
+ Space available for the alert
+ */
+typedef struct DWAlertGeometryContainer {
+    double width;
+    double height;
+    double topInset;
+    double bottomInset;
+    double keyboardHeight;
+    bool isPad;
+} DWAlertGeometryContainer;
+
+typedef struct DWAlertGeometryLayoutInput {
+    /** Maximum allowed height of the alert */
+    double maxHeight;
+    /** Measured height of the content including vertical paddings, 0 if there is no content */
+    double contentHeight;
+    /** Height of all actions */
+    double actionsHeight;
+    /** Height of the actions that stays visible when the content doesn't fit, capped by `actionsHeight` */
+    double actionsMinimumHeight;
+    double separatorSize;
+    bool hasActions;
+} DWAlertGeometryLayoutInput;
+
+typedef struct DWAlertGeometryLayout {
+    double contentScrollHeight;
+    double actionsScrollHeight;
+} DWAlertGeometryLayout;
+
+/**
+ Padding between the alert and the edges of the container (as UIAlertController does)
+ */
+double DWAlertGeometryVerticalPadding(double minInset,
+                                      bool keyboardVisible,
+                                      bool isPad,
+                                      bool isPortrait,
+                                      bool hasTopNotch);
+
+double DWAlertGeometryMaximumAlertHeight(DWAlertGeometryContainer container);
+
+double DWAlertGeometryActionButtonMinHeight(DWAlertGeometryContentSizeCategory category);
+double DWAlertGeometryActionButtonTitlePadding(DWAlertGeometryContentSizeCategory category);
+
+/**
+ Splits the maximum height between the content and the actions scroll views
+ */
+DWAlertGeometryLayout DWAlertGeometryLayoutAlert(DWAlertGeometryLayoutInput input);
+
+/**
+ Only two actions are placed horizontally and only if both titles fit into the half of the alert
+
+ @param titleWidths Widths of action titles, might be NULL if `count` is not 2
+ */
+DWAlertGeometryAxis DWAlertGeometryActionsAxis(const double *titleWidths,
+                                               size_t count,
+                                               double alertWidth,
+                                               double separatorSize);
+
+double DWAlertGeometryActionsHeight(size_t count,
+                                    DWAlertGeometryAxis axis,
+                                    double buttonHeight,
+                                    double separatorSize);
+
+/**
+ Rect of the separator following the action at `index` in the actions coordinate space
+ */
+DWAlertGeometryRect DWAlertGeometrySeparatorRect(size_t index,
+                                                 size_t actionsCount,
+                                                 DWAlertGeometryAxis axis,
+                                                 double width,
+                                                 double buttonHeight,
+                                                 double separatorSize);
+
+/**
+ Range of separators intersecting `rect`. Doesn't depend on the number of actions.
+ */
+DWAlertGeometryRange DWAlertGeometrySeparatorsInRect(DWAlertGeometryRect rect,
+                                                     size_t actionsCount,
+                                                     DWAlertGeometryAxis axis,
+                                                     double width,
+                                                     double buttonHeight,
+                                                     double separatorSize);
+
+bool DWAlertGeometryRectIntersectsRect(DWAlertGeometryRect rect1, DWAlertGeometryRect rect2);
+
+/**
+ Empty rect contains nothing
+ */
+bool DWAlertGeometryRectContainsRect(DWAlertGeometryRect rect1, DWAlertGeometryRect rect2);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DWAlertGeometryCore_h */
@@ -21,6 +21,7 @@
 #import <UIKit/UIKit.h>
 
 #import "DWAlertController/DWAlertAppearanceMode.h"
+#import "DWAlertGeometryCore.h"
 
 // Default iOS UIAlertController's constants
 
@@ -31,6 +32,7 @@ static CGFloat const DWAlertViewContentVerticalPadding = 20.0;
 
 static CGFloat const DWAlertViewCornerRadius = 13.0;
 static CGFloat const DWAlertViewActionsMultilineMinimumHeight = 66.0;
+static CGFloat const DWAlertViewActionTitleMinimumScaleFactor = 0.58;
 
 static CGFloat const DWAlertTransitionAnimationDuration = 0.4;
 static CGFloat const DWAlertTransitionAnimationDampingRatio = 1.0;
@@ -45,70 +47,43 @@ static UIViewAnimationOptions const DWAlertInplaceTransitionAnimationOptions = U
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wunused"
 
-static BOOL DWAlertHasTopNotch(void) {
-    if (@available(iOS 11.0, *)) {
-        return [UIApplication sharedApplication].delegate.window.safeAreaInsets.bottom > 0.0;
-    }
-
-    return NO;
-}
-
-static CGFloat DWAlertViewVerticalPadding(CGFloat minInset, BOOL keyboardVisible) {
-    CGFloat padding = 0.0;
-    if ([UIDevice currentDevice].userInterfaceIdiom == UIUserInterfaceIdiomPad) {
-        if (keyboardVisible) {
-            padding = 20.0;
-        }
-        else {
-            padding = 24.0;
-        }
-    }
-    else {
-        if (UIInterfaceOrientationIsPortrait([UIApplication sharedApplication].statusBarOrientation)) {
-            const BOOL hasTopNotch = DWAlertHasTopNotch();
-            if (keyboardVisible) {
-                padding = hasTopNotch ? minInset : 20.0;
-            }
-            else {
-                padding = hasTopNotch ? 61.0 : 24.0;
-            }
-        }
-        else {
-            padding = 8.0;
-        }
-    }
-
-    return MAX(padding, minInset);
-}
-
 static CGFloat DWAlertViewSeparatorSize(void) {
     return 1.0 / [UIScreen mainScreen].scale;
 }
 
-static CGFloat DWAlertViewActionButtonMinHeight(UIContentSizeCategory category) {
+static DWAlertGeometryRect DWAlertGeometryRectFromCGRect(CGRect rect) {
+    DWAlertGeometryRect result;
+    result.x = CGRectGetMinX(rect);
+    result.y = CGRectGetMinY(rect);
+    result.width = CGRectGetWidth(rect);
+    result.height = CGRectGetHeight(rect);
+    return result;
+}
+
+static DWAlertGeometryContentSizeCategory DWAlertGeometryCategory(UIContentSizeCategory category) {
     if ([category isEqualToString:UIContentSizeCategoryExtraLarge]) {
-        return 47.0;
+        return DWAlertGeometryContentSizeCategoryExtraLarge;
     }
     else if ([category isEqualToString:UIContentSizeCategoryExtraExtraLarge]) {
-        return 49.5;
+        return DWAlertGeometryContentSizeCategoryExtraExtraLarge;
     }
     else if ([category isEqualToString:UIContentSizeCategoryExtraExtraExtraLarge]) {
-        return 51.5;
+        return DWAlertGeometryContentSizeCategoryExtraExtraExtraLarge;
     }
     else if ([category isEqualToString:UIContentSizeCategoryAccessibilityMedium]) {
-        return 67.5;
+        return DWAlertGeometryContentSizeCategoryAccessibilityMedium;
     }
     else if ([category isEqualToString:UIContentSizeCategoryAccessibilityLarge]) {
-        return 79.5;
+        return DWAlertGeometryContentSizeCategoryAccessibilityLarge;
     }
     else if ([category isEqualToString:UIContentSizeCategoryAccessibilityExtraLarge]) {
-        return 96.0;
+        return DWAlertGeometryContentSizeCategoryAccessibilityExtraLarge;
     }
     else if ([category isEqualToString:UIContentSizeCategoryAccessibilityExtraExtraLarge]) {
-        return 112.5;
+        return DWAlertGeometryContentSizeCategoryAccessibilityExtraExtraLarge;
     }
     else if ([category isEqualToString:UIContentSizeCategoryAccessibilityExtraExtraExtraLarge]) {
-        return 125.5;
+        return DWAlertGeometryContentSizeCategoryAccessibilityExtraExtraExtraLarge;
     }
     else {
 #ifdef DEBUG
@@ -127,59 +102,21 @@ static CGFloat DWAlertViewActionButtonMinHeight(UIContentSizeCategory category)
                       @"Unknown category");
         }
 #endif /* DEBUG */
-        return 44.5;
+        return DWAlertGeometryContentSizeCategoryDefault;
     }
 }
 
+static CGFloat DWAlertViewActionButtonMinHeight(UIContentSizeCategory category) {
+    return DWAlertGeometryActionButtonMinHeight(DWAlertGeometryCategory(category));
+}
+
 static CGFloat DWAlertViewActionButtonCurrentMinHeight(void) {
     const UIContentSizeCategory category = [UIApplication sharedApplication].preferredContentSizeCategory;
     return DWAlertViewActionButtonMinHeight(category);
 }
 
 static CGFloat DWAlertViewActionButtonTitlePadding(UIContentSizeCategory category) {
-    if ([category isEqualToString:UIContentSizeCategoryExtraLarge]) {
-        return 12.0;
-    }
-    else if ([category isEqualToString:UIContentSizeCategoryExtraExtraLarge]) {
-        return 12.0;
-    }
-    else if ([category isEqualToString:UIContentSizeCategoryExtraExtraExtraLarge]) {
-        return 12.0;
-    }
-    else if ([category isEqualToString:UIContentSizeCategoryAccessibilityMedium]) {
-        return 16.0;
-    }
-    else if ([category isEqualToString:UIContentSizeCategoryAccessibilityLarge]) {
-        return 16.0;
-    }
-    else if ([category isEqualToString:UIContentSizeCategoryAccessibilityExtraLarge]) {
-        return 16.0;
-    }
-    else if ([category isEqualToString:UIContentSizeCategoryAccessibilityExtraExtraLarge]) {
-        return 16.0;
-    }
-    else if ([category isEqualToString:UIContentSizeCategoryAccessibilityExtraExtraExtraLarge]) {
-        return 16.0;
-    }
-    else {
-#ifdef DEBUG
-        const BOOL isKnownCategory =
-            [category isEqualToString:UIContentSizeCategoryExtraSmall] ||
-            [category isEqualToString:UIContentSizeCategorySmall] ||
-            [category isEqualToString:UIContentSizeCategoryMedium] ||
-            [category isEqualToString:UIContentSizeCategoryLarge];
-        if (@available(iOS 10.0, *)) {
-            NSCAssert([category isEqualToString:UIContentSizeCategoryUnspecified] ||
-                          isKnownCategory,
-                      @"Unknown category");
-        }
-        else {
-            NSCAssert(isKnownCategory,
-                      @"Unknown category");
-        }
-#endif /* DEBUG */
-        return 12.0;
-    }
+    return DWAlertGeometryActionButtonTitlePadding(DWAlertGeometryCategory(category));
 }
 
 API_AVAILABLE(ios(12.0))
@@ -237,6 +174,25 @@ static UIBlurEffect *DWAlertViewBlurEffect(DWAlertAppearanceMode appearanceMode)
     }
 }
 
+static float DWAlertDimmingOpacity(DWAlertAppearanceMode appearanceMode) {
+    if (@available(iOS 13.0, *)) {
+        if (appearanceMode == DWAlertAppearanceModeDark) {
+            return 0.48;
+        }
+        else {
+            return 0.2;
+        }
+    }
+    else {
+        if (appearanceMode == DWAlertAppearanceModeDark) {
+            return 0.48;
+        }
+        else {
+            return 0.4;
+        }
+    }
+}
+
 #pragma clang diagnostic pop
 
 #endif /* DWAlertInternalConstants_h */
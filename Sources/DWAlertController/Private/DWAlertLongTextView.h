@@ -0,0 +1,43 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+#import "DWAlertView.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A view that displays very long text inside of the alert.
+
+ The text is laid out incrementally with TextKit, only for the visible part of the alert's content
+ scroll view (plus a margin). The total height is extrapolated from the already laid out text and
+ refined while the content is being scrolled.
+ */
+@interface DWAlertLongTextView : UIView <DWAlertViewVisibleContentObserving>
+
+@property (copy, nonatomic) NSAttributedString *attributedText;
+
+- (instancetype)initWithAttributedText:(NSAttributedString *)attributedText NS_DESIGNATED_INITIALIZER;
+
+- (nullable instancetype)initWithCoder:(NSCoder *)aDecoder NS_UNAVAILABLE;
+- (instancetype)initWithFrame:(CGRect)frame NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,259 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "DWAlertLongTextView.h"
+
+#import "DWAlertInternalConstants.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Height of the text laid out before the alert is shown, used as a sample for height estimation
+static CGFloat const InitialLayoutHeight = 1024.0;
+// Minimum change of estimated height that causes re-layout of the alert
+static CGFloat const EstimatedHeightUpdateThreshold = 1.0;
+
+#pragma mark - Canvas
+
+/**
+ Renders glyphs of the part of the text covered by its frame
+ */
+@interface DWAlertLongTextCanvasView : UIView
+
+@property (nullable, weak, nonatomic) NSLayoutManager *layoutManager;
+@property (nullable, weak, nonatomic) NSTextContainer *textContainer;
+
+@end
+
+@implementation DWAlertLongTextCanvasView
+
+- (void)drawRect:(CGRect)rect {
+    NSLayoutManager *layoutManager = self.layoutManager;
+    NSTextContainer *textContainer = self.textContainer;
+    if (!layoutManager || !textContainer) {
+        return;
+    }
+
+    const CGPoint origin = self.frame.origin;
+    const CGRect textRect = CGRectOffset(rect, origin.x, origin.y);
+    const NSRange glyphRange = [layoutManager glyphRangeForBoundingRect:textRect inTextContainer:textContainer];
+    const CGPoint drawingPoint = CGPointMake(-origin.x, -origin.y);
+    [layoutManager drawBackgroundForGlyphRange:glyphRange atPoint:drawingPoint];
+    [layoutManager drawGlyphsForGlyphRange:glyphRange atPoint:drawingPoint];
+}
+
+@end
+
+#pragma mark - Long Text View
+
+@interface DWAlertLongTextView ()
+
+@property (readonly, strong, nonatomic) NSTextStorage *textStorage;
+@property (readonly, strong, nonatomic) NSLayoutManager *layoutManager;
+@property (readonly, strong, nonatomic) NSTextContainer *textContainer;
+@property (readonly, strong, nonatomic) DWAlertLongTextCanvasView *canvasView;
+
+@property (assign, nonatomic) CGFloat estimatedHeight;
+@property (assign, nonatomic) CGRect visibleRect;
+
+@end
+
+@implementation DWAlertLongTextView
+
+- (instancetype)initWithAttributedText:(NSAttributedString *)attributedText {
+    self = [super initWithFrame:CGRectZero];
+    if (self) {
+        self.backgroundColor = [UIColor clearColor];
+        self.isAccessibilityElement = YES;
+        self.accessibilityTraits = UIAccessibilityTraitStaticText;
+
+        [self setContentHuggingPriority:UILayoutPriorityRequired forAxis:UILayoutConstraintAxisVertical];
+        [self setContentCompressionResistancePriority:UILayoutPriorityRequired forAxis:UILayoutConstraintAxisVertical];
+
+        const CGFloat width = DWAlertViewWidth - DWAlertViewContentHorizontalPadding * 2.0;
+        NSTextContainer *textContainer = [[NSTextContainer alloc] initWithSize:CGSizeMake(width, CGFLOAT_MAX)];
+        textContainer.lineFragmentPadding = 0.0;
+        _textContainer = textContainer;
+
+        NSLayoutManager *layoutManager = [[NSLayoutManager alloc] init];
+        layoutManager.allowsNonContiguousLayout = YES;
+        [layoutManager addTextContainer:textContainer];
+        _layoutManager = layoutManager;
+
+        NSTextStorage *textStorage = [[NSTextStorage alloc] init];
+        [textStorage addLayoutManager:layoutManager];
+        _textStorage = textStorage;
+
+        DWAlertLongTextCanvasView *canvasView = [[DWAlertLongTextCanvasView alloc] initWithFrame:CGRectZero];
+        canvasView.backgroundColor = [UIColor clearColor];
+        canvasView.contentMode = UIViewContentModeRedraw;
+        canvasView.userInteractionEnabled = NO;
+        canvasView.layoutManager = layoutManager;
+        canvasView.textContainer = textContainer;
+        [self addSubview:canvasView];
+        _canvasView = canvasView;
+
+        self.attributedText = attributedText;
+    }
+    return self;
+}
+
+- (void)setAttributedText:(NSAttributedString *)attributedText {
+    _attributedText = [attributedText copy];
+
+    self.accessibilityLabel = attributedText.string;
+
+    [self.textStorage setAttributedString:attributedText];
+    [self resetLayout];
+}
+
+- (CGSize)intrinsicContentSize {
+    return CGSizeMake(UIViewNoIntrinsicMetric, self.estimatedHeight);
+}
+
+- (void)layoutSubviews {
+    [super layoutSubviews];
+
+    const CGFloat width = CGRectGetWidth(self.bounds);
+    if (width > 0.0 && width != self.textContainer.size.width) {
+        self.textContainer.size = CGSizeMake(width, CGFLOAT_MAX);
+        [self resetLayout];
+    }
+}
+
+- (void)traitCollectionDidChange:(nullable UITraitCollection *)previousTraitCollection {
+    [super traitCollectionDidChange:previousTraitCollection];
+
+    // dynamic colors should be resolved again
+    [self.canvasView setNeedsDisplay];
+}
+
+#pragma mark - DWAlertViewVisibleContentObserving
+
+- (void)alertView:(DWAlertView *)alertView didChangeVisibleContentRect:(CGRect)rect {
+    self.visibleRect = rect;
+
+    if (CGRectContainsRect(self.canvasView.frame, CGRectIntersection(rect, self.bounds))) {
+        return;
+    }
+
+    [self updateCanvasForVisibleRect:rect];
+
+    if ([self updateEstimatedHeight]) {
+        [alertView setNeedsLayout];
+    }
+}
+
+#pragma mark - Private
+
+- (void)resetLayout {
+    // the canvas of the previous layout shouldn't take part in the estimation
+    self.canvasView.frame = CGRectZero;
+
+    const CGFloat width = self.textContainer.size.width;
+    [self.layoutManager ensureLayoutForBoundingRect:CGRectMake(0.0, 0.0, width, InitialLayoutHeight)
+                                    inTextContainer:self.textContainer];
+    [self updateCanvasForVisibleRect:self.visibleRect];
+    [self updateEstimatedHeight];
+}
+
+- (void)updateCanvasForVisibleRect:(CGRect)rect {
+    if (CGRectIsEmpty(rect)) {
+        return;
+    }
+
+    // render one visible height above and below to avoid redrawing on every scroll
+    const CGFloat margin = CGRectGetHeight(rect);
+    CGRect canvasRect = CGRectInset(rect, 0.0, -margin);
+    canvasRect.origin.x = 0.0;
+    canvasRect.origin.y = MAX(0.0, CGRectGetMinY(canvasRect));
+    canvasRect.size.width = self.textContainer.size.width;
+    canvasRect = CGRectIntegral(canvasRect);
+
+    [self.layoutManager ensureLayoutForBoundingRect:canvasRect inTextContainer:self.textContainer];
+
+    self.canvasView.frame = canvasRect;
+    [self.canvasView setNeedsDisplay];
+}
+
+/**
+ Extrapolates the height of the whole text from the furthest laid out part of it.
+
+ @return YES if estimated height has changed significantly
+ */
+- (BOOL)updateEstimatedHeight {
+    const CGFloat estimatedHeight = [self estimateTextHeight];
+    if (fabs(estimatedHeight - self.estimatedHeight) < EstimatedHeightUpdateThreshold) {
+        return NO;
+    }
+
+    self.estimatedHeight = estimatedHeight;
+    [self invalidateIntrinsicContentSize];
+
+    return YES;
+}
+
+- (CGFloat)estimateTextHeight {
+    NSLayoutManager *layoutManager = self.layoutManager;
+    const NSUInteger length = self.textStorage.length;
+    if (length == 0) {
+        return 0.0;
+    }
+
+    // Contiguously laid out prefix of the text
+    NSUInteger laidOutLength = MIN(layoutManager.firstUnlaidCharacterIndex, length);
+    CGFloat laidOutHeight = 0.0;
+    if (laidOutLength > 0) {
+        const NSUInteger lastGlyphIndex = [layoutManager glyphIndexForCharacterAtIndex:laidOutLength - 1];
+        laidOutHeight = CGRectGetMaxY([layoutManager lineFragmentRectForGlyphAtIndex:lastGlyphIndex
+                                                                      effectiveRange:NULL
+                                                             withoutAdditionalLayout:YES]);
+    }
+
+    // With non-contiguous layout the rendered region might be far beyond the prefix
+    // (e.g. after a fast scroll to the end), the text is laid out up to its last glyph as well
+    const CGRect canvasRect = self.canvasView.frame;
+    if (!CGRectIsEmpty(canvasRect)) {
+        const NSRange glyphRange = [layoutManager glyphRangeForBoundingRectWithoutAdditionalLayout:canvasRect
+                                                                                 inTextContainer:self.textContainer];
+        if (glyphRange.length > 0) {
+            const NSUInteger lastGlyphIndex = NSMaxRange(glyphRange) - 1;
+            const NSUInteger canvasLength = MIN([layoutManager characterIndexForGlyphAtIndex:lastGlyphIndex] + 1, length);
+            if (canvasLength > laidOutLength) {
+                laidOutLength = canvasLength;
+                laidOutHeight = CGRectGetMaxY([layoutManager lineFragmentRectForGlyphAtIndex:lastGlyphIndex
+                                                                              effectiveRange:NULL
+                                                                     withoutAdditionalLayout:YES]);
+            }
+        }
+    }
+
+    if (laidOutLength == 0) {
+        return 0.0;
+    }
+
+    if (laidOutLength == length) {
+        laidOutHeight += CGRectGetHeight(layoutManager.extraLineFragmentRect);
+
+        return ceil(laidOutHeight);
+    }
+
+    return ceil(laidOutHeight * ((CGFloat)length / laidOutLength));
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,61 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Immutable sizes of the alert's texts measured off the main thread.
+ Valid only for the content size category and screen scale it was measured for.
+ */
+@interface DWAlertMeasurement : NSObject
+
+@property (readonly, copy, nonatomic) UIContentSizeCategory contentSizeCategory;
+@property (readonly, assign, nonatomic) CGFloat scale;
+
+/**
+ Width available for title and message
+ */
+@property (readonly, assign, nonatomic) CGFloat textWidth;
+@property (readonly, assign, nonatomic) CGFloat titleHeight;
+@property (readonly, assign, nonatomic) CGFloat messageHeight;
+
+/**
+ Captures fonts and environment on the main thread, measures texts on a background queue and
+ calls completion on the main thread.
+ */
++ (void)measureTitle:(nullable NSString *)title
+             message:(nullable NSString *)message
+        actionTitles:(NSArray<NSString *> *)actionTitles
+          completion:(void (^)(DWAlertMeasurement *measurement))completion;
+
+/**
+ YES if content size category and scale haven't changed since the measurement. Main thread only.
+ */
+- (BOOL)isValidForCurrentEnvironment;
+
+/**
+ Width of the action title as laid out by action view in a single line without scaling
+ */
+- (BOOL)getWidth:(CGFloat *)width forActionTitle:(NSString *)title preferred:(BOOL)preferred;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
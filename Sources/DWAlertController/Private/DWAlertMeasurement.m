@@ -0,0 +1,126 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "DWAlertMeasurement.h"
+
+#import "DWAlertInternalConstants.h"
+#import "DWAlertTitleMessageView.h"
+#import "DWAlertViewActionButton.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+static NSString *ActionTitleKey(NSString *title, BOOL preferred) {
+    return [NSString stringWithFormat:@"%d|%@", preferred, title];
+}
+
+static CGFloat ActionTitleWidth(NSString *title, UIFont *font) {
+    return ceil([title sizeWithAttributes:@{NSFontAttributeName : font}].width);
+}
+
+@interface DWAlertMeasurement ()
+
+@property (readonly, copy, nonatomic) NSDictionary<NSString *, NSNumber *> *actionTitleWidths;
+
+@end
+
+@implementation DWAlertMeasurement
+
++ (void)measureTitle:(nullable NSString *)title
+             message:(nullable NSString *)message
+        actionTitles:(NSArray<NSString *> *)actionTitles
+          completion:(void (^)(DWAlertMeasurement *measurement))completion {
+    NSParameterAssert(actionTitles);
+    NSParameterAssert(completion);
+    NSAssert([NSThread isMainThread], @"Main thread is assumed here");
+
+    // UIApplication and UIScreen are main thread only, fonts are safe to use on any thread
+    const UIContentSizeCategory category = [UIApplication sharedApplication].preferredContentSizeCategory;
+    const CGFloat scale = [UIScreen mainScreen].scale;
+    UIFont *titleFont = [DWAlertTitleMessageView titleFont];
+    UIFont *messageFont = [DWAlertTitleMessageView messageFont];
+    UIFont *actionFont = [UIFont dw_alertTitleFont];
+    UIFont *preferredActionFont = [UIFont dw_alertPreferredTitleFont];
+    NSString *titleCopy = [title copy];
+    NSString *messageCopy = [message copy];
+    NSArray<NSString *> *actionTitlesCopy = [actionTitles copy];
+
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+        const CGFloat textWidth = DWAlertViewWidth - DWAlertViewContentHorizontalPadding * 2.0;
+        const CGFloat titleHeight = [DWAlertTitleMessageView heightOfText:titleCopy font:titleFont width:textWidth];
+        const CGFloat messageHeight = [DWAlertTitleMessageView heightOfText:messageCopy font:messageFont width:textWidth];
+
+        NSMutableDictionary<NSString *, NSNumber *> *actionTitleWidths = [NSMutableDictionary dictionary];
+        for (NSString *actionTitle in actionTitlesCopy) {
+            actionTitleWidths[ActionTitleKey(actionTitle, NO)] = @(ActionTitleWidth(actionTitle, actionFont));
+            actionTitleWidths[ActionTitleKey(actionTitle, YES)] = @(ActionTitleWidth(actionTitle, preferredActionFont));
+        }
+
+        DWAlertMeasurement *measurement = [[DWAlertMeasurement alloc] initWithContentSizeCategory:category
+                                                                                            scale:scale
+                                                                                        textWidth:textWidth
+                                                                                      titleHeight:titleHeight
+                                                                                    messageHeight:messageHeight
+                                                                                actionTitleWidths:actionTitleWidths];
+
+        dispatch_async(dispatch_get_main_queue(), ^{
+            completion(measurement);
+        });
+    });
+}
+
+- (instancetype)initWithContentSizeCategory:(UIContentSizeCategory)contentSizeCategory
+                                      scale:(CGFloat)scale
+                                  textWidth:(CGFloat)textWidth
+                                titleHeight:(CGFloat)titleHeight
+                              messageHeight:(CGFloat)messageHeight
+                          actionTitleWidths:(NSDictionary<NSString *, NSNumber *> *)actionTitleWidths {
+    self = [super init];
+    if (self) {
+        _contentSizeCategory = [contentSizeCategory copy];
+        _scale = scale;
+        _textWidth = textWidth;
+        _titleHeight = titleHeight;
+        _messageHeight = messageHeight;
+        _actionTitleWidths = [actionTitleWidths copy];
+    }
+    return self;
+}
+
+- (BOOL)isValidForCurrentEnvironment {
+    NSAssert([NSThread isMainThread], @"Main thread is assumed here");
+
+    const UIContentSizeCategory category = [UIApplication sharedApplication].preferredContentSizeCategory;
+    return [category isEqualToString:self.contentSizeCategory] &&
+           [UIScreen mainScreen].scale == self.scale;
+}
+
+- (BOOL)getWidth:(CGFloat *)width forActionTitle:(NSString *)title preferred:(BOOL)preferred {
+    NSParameterAssert(width);
+
+    NSNumber *value = self.actionTitleWidths[ActionTitleKey(title, preferred)];
+    if (!value) {
+        return NO;
+    }
+
+    *width = value.doubleValue;
+
+    return YES;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,42 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Shared window above the app's windows hosting alerts shown with `-[DWAlertController showAnimated:completion:]`.
+ Alerts are presented from its own empty root controller, so the app's view controller hierarchy is neither
+ walked nor touched. The window is created once and is hidden while there are no alerts.
+ */
+@interface DWAlertOverlayWindow : UIWindow
+
++ (instancetype)sharedWindow;
+
+- (void)presentAlertController:(UIViewController *)alertController
+                      animated:(BOOL)animated
+                    completion:(void (^__nullable)(void))completion;
+
+/**
+ Hides the window if there are no more alerts presented in it
+ */
+- (void)hideIfNeeded;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,155 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "DWAlertOverlayWindow.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Root Controller
+
+@interface DWAlertOverlayRootViewController : UIViewController
+
+@property (nullable, weak, nonatomic) UIWindow *hostWindow;
+
+@end
+
+@implementation DWAlertOverlayRootViewController
+
+- (void)loadView {
+    UIView *view = [[UIView alloc] initWithFrame:[UIScreen mainScreen].bounds];
+    view.backgroundColor = [UIColor clearColor];
+    self.view = view;
+}
+
+// Keep status bar and rotation behaviour of the app's window underneath.
+// Only its root controller is asked, the presented controllers of the app are not walked.
+
+- (UIStatusBarStyle)preferredStatusBarStyle {
+    UIViewController *controller = self.hostWindow.rootViewController;
+    return controller ? controller.preferredStatusBarStyle : [super preferredStatusBarStyle];
+}
+
+- (BOOL)prefersStatusBarHidden {
+    UIViewController *controller = self.hostWindow.rootViewController;
+    return controller ? controller.prefersStatusBarHidden : [super prefersStatusBarHidden];
+}
+
+- (UIInterfaceOrientationMask)supportedInterfaceOrientations {
+    UIViewController *controller = self.hostWindow.rootViewController;
+    return controller ? controller.supportedInterfaceOrientations : [super supportedInterfaceOrientations];
+}
+
+- (BOOL)shouldAutorotate {
+    UIViewController *controller = self.hostWindow.rootViewController;
+    return controller ? controller.shouldAutorotate : [super shouldAutorotate];
+}
+
+@end
+
+#pragma mark - Window
+
+@interface DWAlertOverlayWindow ()
+
+@property (readonly, strong, nonatomic) DWAlertOverlayRootViewController *overlayRootViewController;
+
+@end
+
+@implementation DWAlertOverlayWindow
+
++ (instancetype)sharedWindow {
+    NSAssert([NSThread isMainThread], @"Main thread is assumed here");
+
+    static DWAlertOverlayWindow *sharedWindow = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedWindow = [[self alloc] initWithFrame:[UIScreen mainScreen].bounds];
+    });
+    return sharedWindow;
+}
+
+- (instancetype)initWithFrame:(CGRect)frame {
+    self = [super initWithFrame:frame];
+    if (self) {
+        self.windowLevel = UIWindowLevelAlert;
+        self.backgroundColor = [UIColor clearColor];
+        self.hidden = YES;
+
+        DWAlertOverlayRootViewController *rootViewController = [[DWAlertOverlayRootViewController alloc] init];
+        self.rootViewController = rootViewController;
+        _overlayRootViewController = rootViewController;
+    }
+    return self;
+}
+
+- (void)presentAlertController:(UIViewController *)alertController
+                      animated:(BOOL)animated
+                    completion:(void (^__nullable)(void))completion {
+    NSParameterAssert(alertController);
+    NSAssert([NSThread isMainThread], @"Main thread is assumed here");
+
+    if (self.hidden) {
+        [self showAboveKeyWindow];
+    }
+
+    // another alert might be already shown in the overlay, present on top of it
+    UIViewController *presentingViewController = self.overlayRootViewController;
+    while (presentingViewController.presentedViewController) {
+        presentingViewController = presentingViewController.presentedViewController;
+    }
+    [presentingViewController presentViewController:alertController animated:animated completion:completion];
+}
+
+- (void)hideIfNeeded {
+    // let a replacing alert (if any) to be presented first
+    dispatch_async(dispatch_get_main_queue(), ^{
+        if (self.hidden || self.overlayRootViewController.presentedViewController) {
+            return;
+        }
+
+        UIWindow *hostWindow = self.overlayRootViewController.hostWindow;
+        self.overlayRootViewController.hostWindow = nil;
+        self.hidden = YES;
+        [hostWindow makeKeyWindow];
+    });
+}
+
+#pragma mark - Private
+
+- (void)showAboveKeyWindow {
+    UIWindow *hostWindow = [UIApplication sharedApplication].keyWindow;
+    if (hostWindow == self) {
+        hostWindow = nil;
+    }
+    self.overlayRootViewController.hostWindow = hostWindow;
+
+    if (@available(iOS 13.0, *)) {
+        UIWindowScene *windowScene = hostWindow.windowScene;
+        if (windowScene && self.windowScene != windowScene) {
+            self.windowScene = windowScene;
+        }
+    }
+    if (hostWindow && !CGRectEqualToRect(self.frame, hostWindow.frame)) {
+        self.frame = hostWindow.frame;
+    }
+
+    // key window is required for text input within alerts
+    [self makeKeyAndVisible];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
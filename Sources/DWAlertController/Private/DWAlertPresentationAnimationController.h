@@ -15,11 +15,11 @@
 //  limitations under the License.
 //
 
-#import <UIKit/UIKit.h>
+#import "DWAlertBaseAnimationController.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
-@interface DWAlertPresentationAnimationController : NSObject <UIViewControllerAnimatedTransitioning>
+@interface DWAlertPresentationAnimationController : DWAlertBaseAnimationController
 
 @end
 
@@ -31,6 +31,16 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nullable, strong, nonatomic) DWDimmingView *dimmingView;
 
+/**
+ Already visible dimming view of the previous alert to use instead of creating a new one
+ */
+@property (nullable, strong, nonatomic) DWDimmingView *reusableDimmingView;
+
+/**
+ If YES, the dimming view stays visible after dismissal so the next alert can reuse it
+ */
+@property (assign, nonatomic) BOOL keepsDimmingViewOnDismissal;
+
 @end
 
 NS_ASSUME_NONNULL_END
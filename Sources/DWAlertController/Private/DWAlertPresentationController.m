@@ -18,28 +18,10 @@
 #import "DWAlertPresentationController.h"
 
 #import "DWAlertInternalConstants.h"
+#import "DWAlertViewTheme.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
-static float DimmingOpacity(DWAlertAppearanceMode mode) {
-    if (@available(iOS 13.0, *)) {
-        if (mode == DWAlertAppearanceModeDark) {
-            return 0.48;
-        }
-        else {
-            return 0.2;
-        }
-    }
-    else {
-        if (mode == DWAlertAppearanceModeDark) {
-            return 0.48;
-        }
-        else {
-            return 0.4;
-        }
-    }
-}
-
 @implementation DWAlertPresentationController
 
 - (void)setAppearanceMode:(DWAlertAppearanceMode)appearanceMode {
@@ -56,53 +38,52 @@ static float DimmingOpacity(DWAlertAppearanceMode mode) {
     return NO;
 }
 
+// Dimming view alpha is animated by the transition animation controllers
+
 - (void)presentationTransitionWillBegin {
-    self.dimmingView = [[DWDimmingView alloc] initWithFrame:self.containerView.bounds];
-    self.dimmingView.autoresizingMask = UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight;
-    self.dimmingView.alpha = 0.0;
-    [self.containerView addSubview:self.dimmingView];
-
-    DWAlertAppearanceMode appearanceMode = self.appearanceMode;
-    if (@available(iOS 12.0, *)) {
-        if (appearanceMode == DWAlertAppearanceModeAutomatic) {
-            const UIUserInterfaceStyle interfaceStyle = self.traitCollection.userInterfaceStyle;
-            appearanceMode = DWAlertAppearanceModeForUIInterfaceStyle(interfaceStyle);
-        }
+    DWDimmingView *dimmingView = self.reusableDimmingView;
+    self.reusableDimmingView = nil;
+    if (dimmingView) {
+        // the handed off dimming keeps its current alpha, the presentation animates it to 1
+        dimmingView.frame = self.containerView.bounds;
     }
-    [self updateAppearanceForMode:appearanceMode];
+    else {
+        dimmingView = [[DWDimmingView alloc] initWithFrame:self.containerView.bounds];
+        dimmingView.autoresizingMask = UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight;
+        dimmingView.alpha = 0.0;
+    }
+    [self.containerView addSubview:dimmingView];
+    self.dimmingView = dimmingView;
 
-    id<UIViewControllerTransitionCoordinator> transitionCoordinator = [self.presentingViewController transitionCoordinator];
-    [transitionCoordinator
-        animateAlongsideTransition:^(id<UIViewControllerTransitionCoordinatorContext> context) {
-            self.dimmingView.alpha = 1.0;
-        }
-                        completion:nil];
+    [self updateAppearanceForMode:self.appearanceMode];
 }
 
 - (void)presentationTransitionDidEnd:(BOOL)completed {
     [super presentationTransitionDidEnd:completed];
 
-    if (!completed) {
+    if (completed) {
+        // non-animated presentation
+        self.dimmingView.alpha = 1.0;
+    }
+    else {
         [self.dimmingView removeFromSuperview];
     }
 }
 
-- (void)dismissalTransitionWillBegin {
-    [super dismissalTransitionWillBegin];
-
-    id<UIViewControllerTransitionCoordinator> transitionCoordinator = [self.presentingViewController transitionCoordinator];
-    [transitionCoordinator
-        animateAlongsideTransition:^(id<UIViewControllerTransitionCoordinatorContext> context) {
-            self.dimmingView.alpha = 0.0;
-        }
-                        completion:nil];
-}
-
 - (void)dismissalTransitionDidEnd:(BOOL)completed {
     [super dismissalTransitionDidEnd:completed];
 
     if (completed) {
-        [self.dimmingView removeFromSuperview];
+        if (self.keepsDimmingViewOnDismissal) {
+            // keep dimming on screen until the next alert picks it up
+            UIView *dimmingView = self.dimmingView;
+            UIWindow *window = self.containerView.window;
+            dimmingView.frame = [window convertRect:dimmingView.frame fromView:dimmingView.superview];
+            [window addSubview:dimmingView];
+        }
+        else {
+            [self.dimmingView removeFromSuperview];
+        }
     }
 }
 
@@ -118,19 +99,17 @@ static float DimmingOpacity(DWAlertAppearanceMode mode) {
 - (void)traitCollectionDidChange:(nullable UITraitCollection *)previousTraitCollection {
     [super traitCollectionDidChange:previousTraitCollection];
 
-    if (@available(iOS 12.0, *)) {
-        const UIUserInterfaceStyle style = self.traitCollection.userInterfaceStyle;
-        if (self.appearanceMode == DWAlertAppearanceModeAutomatic) {
-            DWAlertAppearanceMode appearanceMode = DWAlertAppearanceModeForUIInterfaceStyle(style);
-            [self updateAppearanceForMode:appearanceMode];
-        }
+    if (self.appearanceMode == DWAlertAppearanceModeAutomatic) {
+        [self updateAppearanceForMode:DWAlertAppearanceModeAutomatic];
     }
 }
 
 #pragma mark - Private
 
 - (void)updateAppearanceForMode:(DWAlertAppearanceMode)mode {
-    self.dimmingView.dimmingOpacity = DimmingOpacity(mode);
+    DWAlertViewTheme *theme = [DWAlertViewTheme themeForAppearanceMode:mode
+                                                       traitCollection:self.traitCollection];
+    self.dimmingView.dimmingOpacity = theme.dimmingOpacity;
 }
 
 @end
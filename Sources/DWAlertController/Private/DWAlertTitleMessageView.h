@@ -0,0 +1,64 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Lightweight frame-based view that draws alert's title and message.
+ */
+@interface DWAlertTitleMessageView : UIView
+
+@property (nullable, readonly, copy, nonatomic) NSString *title;
+@property (nullable, readonly, copy, nonatomic) NSString *message;
+
+- (instancetype)initWithTitle:(nullable NSString *)title message:(nullable NSString *)message NS_DESIGNATED_INITIALIZER;
+
+/**
+ Height required to display title and message at the given width for the current content size category.
+ Result is cached until width or content size category is changed.
+ */
+- (CGFloat)heightForWidth:(CGFloat)width;
+
+/**
+ Seeds measurements done in advance (see `DWAlertMeasurement`).
+ Ignored if the content size category has changed since then.
+ */
+- (void)setMeasuredTitleHeight:(CGFloat)titleHeight
+                 messageHeight:(CGFloat)messageHeight
+                      forWidth:(CGFloat)width
+           contentSizeCategory:(UIContentSizeCategory)contentSizeCategory;
+
+/**
+ Fonts for the current content size category
+ */
++ (UIFont *)titleFont;
++ (UIFont *)messageFont;
+
+/**
+ Height of the text laid out as the title or message. Safe to call on any thread.
+ */
++ (CGFloat)heightOfText:(nullable NSString *)text font:(UIFont *)font width:(CGFloat)width;
+
+- (nullable instancetype)initWithCoder:(NSCoder *)aDecoder NS_UNAVAILABLE;
+- (instancetype)initWithFrame:(CGRect)frame NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
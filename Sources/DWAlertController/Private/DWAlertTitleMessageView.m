@@ -0,0 +1,193 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "DWAlertTitleMessageView.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+static CGFloat const TitleMessageSpacing = 4.0;
+static NSStringDrawingOptions const DrawingOptions = NSStringDrawingUsesLineFragmentOrigin | NSStringDrawingUsesFontLeading;
+
+@interface DWAlertTitleMessageView ()
+
+@property (nullable, strong, nonatomic) NSAttributedString *attributedTitle;
+@property (nullable, strong, nonatomic) NSAttributedString *attributedMessage;
+@property (nullable, copy, nonatomic) UIContentSizeCategory contentSizeCategory;
+
+@property (assign, nonatomic) CGFloat measuredWidth;
+@property (assign, nonatomic) CGFloat titleHeight;
+@property (assign, nonatomic) CGFloat messageHeight;
+
+@end
+
+@implementation DWAlertTitleMessageView
+
+- (instancetype)initWithTitle:(nullable NSString *)title message:(nullable NSString *)message {
+    self = [super initWithFrame:CGRectZero];
+    if (self) {
+        _title = [title copy];
+        _message = [message copy];
+
+        self.backgroundColor = [UIColor clearColor];
+        self.opaque = NO;
+        self.contentMode = UIViewContentModeRedraw;
+        self.userInteractionEnabled = NO;
+
+        self.isAccessibilityElement = YES;
+        self.accessibilityTraits = UIAccessibilityTraitStaticText;
+        NSMutableArray<NSString *> *accessibilityComponents = [NSMutableArray array];
+        if (title.length > 0) {
+            [accessibilityComponents addObject:title];
+        }
+        if (message.length > 0) {
+            [accessibilityComponents addObject:message];
+        }
+        self.accessibilityLabel = [accessibilityComponents componentsJoinedByString:@", "];
+    }
+    return self;
+}
+
+- (CGFloat)heightForWidth:(CGFloat)width {
+    [self updateAttributedStringsIfNeeded];
+
+    if (width != self.measuredWidth) {
+        self.measuredWidth = width;
+
+        self.titleHeight = [self.class heightOfText:self.title font:[self.class titleFont] width:width];
+        self.messageHeight = [self.class heightOfText:self.message font:[self.class messageFont] width:width];
+    }
+
+    CGFloat height = self.titleHeight + self.messageHeight;
+    if (self.titleHeight > 0.0 && self.messageHeight > 0.0) {
+        height += TitleMessageSpacing;
+    }
+
+    return height;
+}
+
+- (void)setMeasuredTitleHeight:(CGFloat)titleHeight
+                 messageHeight:(CGFloat)messageHeight
+                      forWidth:(CGFloat)width
+           contentSizeCategory:(UIContentSizeCategory)contentSizeCategory {
+    [self updateAttributedStringsIfNeeded];
+
+    if (![contentSizeCategory isEqualToString:self.contentSizeCategory]) {
+        return;
+    }
+
+    self.measuredWidth = width;
+    self.titleHeight = titleHeight;
+    self.messageHeight = messageHeight;
+}
+
++ (UIFont *)titleFont {
+    return [UIFont preferredFontForTextStyle:UIFontTextStyleHeadline];
+}
+
++ (UIFont *)messageFont {
+    return [UIFont preferredFontForTextStyle:UIFontTextStyleFootnote];
+}
+
++ (CGFloat)heightOfText:(nullable NSString *)text font:(UIFont *)font width:(CGFloat)width {
+    if (text.length == 0) {
+        return 0.0;
+    }
+
+    NSMutableParagraphStyle *paragraphStyle = [[NSMutableParagraphStyle alloc] init];
+    paragraphStyle.alignment = NSTextAlignmentCenter;
+    NSDictionary<NSAttributedStringKey, id> *attributes = @{
+        NSFontAttributeName : font,
+        NSParagraphStyleAttributeName : paragraphStyle,
+    };
+    const CGRect rect = [text boundingRectWithSize:CGSizeMake(width, CGFLOAT_MAX)
+                                           options:DrawingOptions
+                                        attributes:attributes
+                                           context:nil];
+
+    return ceil(CGRectGetHeight(rect));
+}
+
+- (void)drawRect:(CGRect)rect {
+    const CGFloat width = CGRectGetWidth(self.bounds);
+    [self heightForWidth:width];
+
+    CGFloat y = 0.0;
+    if (self.attributedTitle) {
+        [self.attributedTitle drawWithRect:CGRectMake(0.0, y, width, self.titleHeight)
+                                   options:DrawingOptions
+                                   context:nil];
+        y += self.titleHeight + TitleMessageSpacing;
+    }
+
+    if (self.attributedMessage) {
+        [self.attributedMessage drawWithRect:CGRectMake(0.0, y, width, self.messageHeight)
+                                     options:DrawingOptions
+                                     context:nil];
+    }
+}
+
+- (void)traitCollectionDidChange:(nullable UITraitCollection *)previousTraitCollection {
+    [super traitCollectionDidChange:previousTraitCollection];
+
+    // dynamic colors should be resolved again
+    [self setNeedsDisplay];
+}
+
+#pragma mark - Private
+
+- (void)updateAttributedStringsIfNeeded {
+    const UIContentSizeCategory category = [UIApplication sharedApplication].preferredContentSizeCategory;
+    if ([category isEqualToString:self.contentSizeCategory]) {
+        return;
+    }
+    self.contentSizeCategory = category;
+    self.measuredWidth = 0.0; // reset measurements
+
+    UIColor *textColor = nil;
+    if (@available(iOS 13.0, *)) {
+        textColor = [UIColor labelColor];
+    }
+    else {
+        textColor = [UIColor blackColor];
+    }
+
+    NSMutableParagraphStyle *paragraphStyle = [[NSMutableParagraphStyle alloc] init];
+    paragraphStyle.alignment = NSTextAlignmentCenter;
+
+    if (self.title.length > 0) {
+        self.attributedTitle = [[NSAttributedString alloc] initWithString:self.title
+                                                               attributes:@{
+                                                                   NSFontAttributeName : [self.class titleFont],
+                                                                   NSForegroundColorAttributeName : textColor,
+                                                                   NSParagraphStyleAttributeName : paragraphStyle,
+                                                               }];
+    }
+    if (self.message.length > 0) {
+        self.attributedMessage = [[NSAttributedString alloc] initWithString:self.message
+                                                                 attributes:@{
+                                                                     NSFontAttributeName : [self.class messageFont],
+                                                                     NSForegroundColorAttributeName : textColor,
+                                                                     NSParagraphStyleAttributeName : paragraphStyle,
+                                                                 }];
+    }
+
+    [self setNeedsDisplay];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -30,6 +30,22 @@ NS_ASSUME_NONNULL_BEGIN
 
 @end
 
+/**
+ Content child view may adopt this protocol to be notified about its visible part within the
+ content scroll view of the alert (e.g. to lay out or render only what is on the screen).
+ */
+@protocol DWAlertViewVisibleContentObserving <NSObject>
+
+/**
+ Called on every scroll of the content and after the alert layout is updated.
+
+ @param alertView The alert view hosting the content view
+ @param rect The visible rect in the coordinate space of the content child view
+ */
+- (void)alertView:(DWAlertView *)alertView didChangeVisibleContentRect:(CGRect)rect;
+
+@end
+
 /**
  Internal view of DWAlertController
  */
@@ -45,14 +61,38 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, assign) DWAlertAppearanceMode appearanceMode;
 
-@property (strong, nonatomic) UIColor *normalTintColor UI_APPEARANCE_SELECTOR;
-@property (strong, nonatomic) UIColor *disabledTintColor UI_APPEARANCE_SELECTOR;
-@property (strong, nonatomic) UIColor *destructiveTintColor UI_APPEARANCE_SELECTOR;
+/**
+ Tint colors of the action views. Resetting to `nil` falls back to the current theme's defaults.
+ */
+@property (null_resettable, strong, nonatomic) UIColor *normalTintColor UI_APPEARANCE_SELECTOR;
+@property (null_resettable, strong, nonatomic) UIColor *disabledTintColor UI_APPEARANCE_SELECTOR;
+@property (null_resettable, strong, nonatomic) UIColor *destructiveTintColor UI_APPEARANCE_SELECTOR;
 
+/**
+ Displays title and message directly within the content view without a child view.
+ Can't be combined with `setupChildView:`.
+ */
+- (void)setupTitle:(nullable NSString *)title message:(nullable NSString *)message;
 - (void)setupChildView:(UIView *)childView;
 - (void)addAction:(DWAlertAction *)action;
+
+/**
+ Updates action views to match the actions.
+ Views of matching actions (the same object or the same `identifier`) are reused and updated in place.
+ */
+- (void)setupActions:(NSArray<DWAlertAction *> *)actions;
 - (void)resetActionsState;
-- (void)removeAllActions;
+
+/**
+ Shows or hides activity indicator in place of the title of the action
+ */
+- (void)setActivityIndicatorVisible:(BOOL)visible forAction:(DWAlertAction *)action;
+
+/**
+ Measures title, message and action titles on a background queue and uses the result during the layout.
+ The child content view is still measured during the layout.
+ */
+- (void)measureTextsWithCompletion:(void (^__nullable)(void))completion;
 
 - (nullable instancetype)initWithCoder:(NSCoder *)aDecoder NS_UNAVAILABLE;
 - (instancetype)init NS_UNAVAILABLE;
@@ -20,7 +20,10 @@
 #import "DWAlertController/DWAlertAction.h"
 #import "DWActionsStackView.h"
 #import "DWAlertInternalConstants.h"
+#import "DWAlertMeasurement.h"
+#import "DWAlertTitleMessageView.h"
 #import "DWAlertViewActionButton.h"
+#import "DWAlertViewTheme.h"
 #import "DWDimmingView.h"
 
 NS_ASSUME_NONNULL_BEGIN
@@ -66,6 +69,8 @@ NS_ASSUME_NONNULL_BEGIN
 @property (readonly, strong, nonatomic) UIVisualEffectView *vibrancyEffectView;
 @property (readonly, strong, nonatomic) UIScrollView *contentScrollView;
 @property (readonly, strong, nonatomic) UIView *contentView;
+@property (readonly, strong, nonatomic) NSLayoutConstraint *contentViewHeightConstraint;
+@property (nullable, strong, nonatomic) DWAlertTitleMessageView *titleMessageView;
 @property (readonly, strong, nonatomic) UIScrollView *actionsScrollView;
 @property (readonly, strong, nonatomic) DWActionsStackView *actionsStackView;
 @property (readonly, strong, nonatomic) NSLayoutConstraint *actionsStackViewHeightConstraint;
@@ -73,20 +78,22 @@ NS_ASSUME_NONNULL_BEGIN
 @property (readonly, strong, nonatomic) UIScrollView *effectsScrollView;
 @property (readonly, strong, nonatomic) UIView *actionTouchHighlightView;
 @property (readonly, strong, nonatomic) DWDimmingView *separatorView;
+@property (readonly, strong, nonatomic) UIView *backgroundView;
 @property (nullable, nonatomic, weak) UIView *contentViewChildView;
+@property (strong, nonatomic) DWAlertViewTheme *theme;
+@property (assign, nonatomic) BOOL needsUpdateActionsTintColors;
+@property (assign, nonatomic) CGRect separatorsIgnoringRect;
+@property (assign, nonatomic) CGRect separatorsRenderedRect;
 
 @end
 
-@implementation DWAlertView
+/**
+ Part of the visible actions height rendered above and below the visible area
+ so that separators are rebuilt only once per such distance of scrolling
+ */
+static CGFloat const DWAlertViewSeparatorsRenderingMarginRatio = 1.0;
 
-+ (void)initialize {
-    if (self == DWAlertView.class) {
-        DWAlertView *alertControllerAppearance = [DWAlertView appearance];
-        alertControllerAppearance.normalTintColor = DWAlertViewNormalTextColor();
-        alertControllerAppearance.disabledTintColor = DWAlertViewDisabledTextColor();
-        alertControllerAppearance.destructiveTintColor = DWAlertViewDestructiveTextColor();
-    }
-}
+@implementation DWAlertView
 
 - (instancetype)initWithFrame:(CGRect)frame {
     self = [super initWithFrame:frame];
@@ -94,20 +101,21 @@ NS_ASSUME_NONNULL_BEGIN
         self.layer.cornerRadius = DWAlertViewCornerRadius;
         self.layer.masksToBounds = YES;
 
-        UIView *whiteView = [[UIView alloc] initWithFrame:self.bounds];
-        whiteView.autoresizingMask = UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight;
-        whiteView.backgroundColor = DWAlertViewBackgroundViewColor();
-        [self addSubview:whiteView];
+        DWAlertViewTheme *theme = [DWAlertViewTheme themeForAppearanceMode:DWAlertAppearanceModeAutomatic
+                                                           traitCollection:self.traitCollection];
 
-        UIBlurEffect *blurEffect = DWAlertViewBlurEffect(DWAlertAppearanceModeAutomatic);
-        UIVisualEffectView *blurEffectView = [[UIVisualEffectView alloc] initWithEffect:blurEffect];
+        UIView *backgroundView = [[UIView alloc] initWithFrame:self.bounds];
+        backgroundView.autoresizingMask = UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight;
+        [self addSubview:backgroundView];
+        _backgroundView = backgroundView;
+
+        UIVisualEffectView *blurEffectView = [[UIVisualEffectView alloc] initWithEffect:theme.blurEffect];
         blurEffectView.frame = self.bounds;
         blurEffectView.autoresizingMask = UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight;
         [self addSubview:blurEffectView];
         _blurEffectView = blurEffectView;
 
-        UIVibrancyEffect *vibrancyEffect = [UIVibrancyEffect effectForBlurEffect:blurEffect];
-        UIVisualEffectView *vibrancyEffectView = [[UIVisualEffectView alloc] initWithEffect:vibrancyEffect];
+        UIVisualEffectView *vibrancyEffectView = [[UIVisualEffectView alloc] initWithEffect:theme.vibrancyEffect];
         vibrancyEffectView.frame = blurEffectView.contentView.bounds;
         vibrancyEffectView.autoresizingMask = UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight;
         [blurEffectView.contentView addSubview:vibrancyEffectView];
@@ -115,9 +123,7 @@ NS_ASSUME_NONNULL_BEGIN
 
         UIView *vibrancyContentView = vibrancyEffectView.contentView;
 
-        UIColor *separatorColor = DWAlertViewSeparatorColor(DWAlertAppearanceModeAutomatic);
         UIView *contentActionsSeparatorView = [[UIView alloc] initWithFrame:CGRectZero];
-        contentActionsSeparatorView.backgroundColor = separatorColor;
         [vibrancyContentView addSubview:contentActionsSeparatorView];
         _contentActionsSeparatorView = contentActionsSeparatorView;
 
@@ -127,14 +133,12 @@ NS_ASSUME_NONNULL_BEGIN
 
         DWDimmingView *separatorView = [[DWDimmingView alloc] initWithFrame:CGRectZero];
         separatorView.inverted = YES;
-        separatorView.dimmingColor = separatorColor;
         separatorView.dimmingOpacity = 1.0;
         [separatorView setPathAnimationsDisabled];
         [effectsScrollView addSubview:separatorView];
         _separatorView = separatorView;
 
         UIView *actionTouchHighlightView = [[UIView alloc] initWithFrame:CGRectZero];
-        actionTouchHighlightView.backgroundColor = DWAlertViewActionTouchHighlightColor(DWAlertAppearanceModeAutomatic);
         [effectsScrollView addSubview:actionTouchHighlightView];
         _actionTouchHighlightView = actionTouchHighlightView;
 
@@ -150,6 +154,7 @@ NS_ASSUME_NONNULL_BEGIN
         _actionsStackView = actionsStackView;
 
         UIScrollView *contentScrollView = [[UIScrollView alloc] initWithFrame:CGRectZero];
+        contentScrollView.delegate = self;
         [self addSubview:contentScrollView];
         _contentScrollView = contentScrollView;
 
@@ -158,6 +163,9 @@ NS_ASSUME_NONNULL_BEGIN
         [contentScrollView addSubview:contentView];
         _contentView = contentView;
 
+        // used only when the content is laid out manually (title / message)
+        _contentViewHeightConstraint = [contentView.heightAnchor constraintEqualToConstant:0.0];
+
         [NSLayoutConstraint activateConstraints:@[
             [actionsStackView.topAnchor constraintEqualToAnchor:actionsScrollView.topAnchor],
             [actionsStackView.leadingAnchor constraintEqualToAnchor:actionsScrollView.leadingAnchor],
@@ -173,10 +181,7 @@ NS_ASSUME_NONNULL_BEGIN
             [contentView.widthAnchor constraintEqualToAnchor:self.widthAnchor],
         ]];
 
-        if (@available(iOS 12.0, *)) {
-            const UIUserInterfaceStyle interfaceStyle = self.traitCollection.userInterfaceStyle;
-            [self updateAppearanceForMode:DWAlertAppearanceModeForUIInterfaceStyle(interfaceStyle)];
-        }
+        [self applyTheme:theme];
     }
     return self;
 }
@@ -184,6 +189,8 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)layoutSubviews {
     [super layoutSubviews];
 
+    [self updateActionsTintColorsIfNeeded];
+
     const CGFloat width = CGRectGetWidth(self.bounds);
     const BOOL hasActions = self.actionsStackView.arrangedSubviews.count > 0;
     const CGFloat separatorSize = DWAlertViewSeparatorSize();
@@ -191,34 +198,38 @@ NS_ASSUME_NONNULL_BEGIN
     NSAssert(heightConstraint, @"DWAlertView has invalid layout");
     const CGFloat maxHeight = heightConstraint.constant;
 
-    CGFloat contentHeight =
-        [self.contentViewChildView systemLayoutSizeFittingSize:UILayoutFittingCompressedSize].height;
-    if (contentHeight > 0) {
-        contentHeight += DWAlertViewContentVerticalPadding * 2;
+    CGFloat contentHeight = 0.0;
+    DWAlertTitleMessageView *titleMessageView = self.titleMessageView;
+    if (titleMessageView) {
+        const CGFloat textWidth = width - DWAlertViewContentHorizontalPadding * 2.0;
+        contentHeight = [titleMessageView heightForWidth:textWidth];
+        titleMessageView.frame = CGRectMake(DWAlertViewContentHorizontalPadding,
+                                            DWAlertViewContentVerticalPadding,
+                                            textWidth,
+                                            contentHeight);
     }
-
-    const CGFloat actionsHeight = self.actionsStackViewHeightConstraint.constant;
-    CGFloat maxContentHeight = maxHeight;
-    if (hasActions) {
-        maxContentHeight -= DWAlertViewActionsMultilineMinimumHeight;
+    else {
+        contentHeight =
+            [self.contentViewChildView systemLayoutSizeFittingSize:UILayoutFittingCompressedSize].height;
     }
-
-    CGFloat leftOverForActions;
-    CGFloat contentScrollHeight;
-    if (contentHeight < maxContentHeight) {
-        contentScrollHeight = contentHeight;
-        leftOverForActions = maxHeight - contentHeight - separatorSize;
+    if (contentHeight > 0) {
+        contentHeight += DWAlertViewContentVerticalPadding * 2;
     }
-    else {
-        contentScrollHeight = maxContentHeight;
-        if (hasActions) {
-            contentScrollHeight -= separatorSize;
-        }
-        leftOverForActions = maxHeight - contentHeight;
+    if (titleMessageView) {
+        self.contentViewHeightConstraint.constant = contentHeight;
     }
 
-    const CGFloat actionsScrollHeight = MAX(MIN(actionsHeight, DWAlertViewActionsMultilineMinimumHeight),
-                                            MIN(actionsHeight, leftOverForActions));
+    const CGFloat actionsHeight = self.actionsStackViewHeightConstraint.constant;
+    DWAlertGeometryLayoutInput layoutInput;
+    layoutInput.maxHeight = maxHeight;
+    layoutInput.contentHeight = contentHeight;
+    layoutInput.actionsHeight = actionsHeight;
+    layoutInput.actionsMinimumHeight = DWAlertViewActionsMultilineMinimumHeight;
+    layoutInput.separatorSize = separatorSize;
+    layoutInput.hasActions = hasActions;
+    const DWAlertGeometryLayout layout = DWAlertGeometryLayoutAlert(layoutInput);
+    const CGFloat contentScrollHeight = layout.contentScrollHeight;
+    const CGFloat actionsScrollHeight = layout.actionsScrollHeight;
 
     const CGRect contentScrollFrame = CGRectMake(0.0, 0.0, width, contentScrollHeight);
     const CGRect actionsScrollFrame = CGRectMake(0.0, contentScrollHeight + separatorSize, width, actionsScrollHeight);
@@ -237,6 +248,7 @@ NS_ASSUME_NONNULL_BEGIN
     self.actionsScrollView.contentSize = CGSizeMake(width, actionsHeight);
 
     [self updateSeparatorsLayoutIgnoringRect:CGRectZero];
+    [self updateVisibleContentRect];
 
     if (shouldInvalidateIntrinsicContentSize) {
         [self invalidateIntrinsicContentSize];
@@ -267,12 +279,8 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)traitCollectionDidChange:(nullable UITraitCollection *)previousTraitCollection {
     [super traitCollectionDidChange:previousTraitCollection];
 
-    if (@available(iOS 12.0, *)) {
-        const UIUserInterfaceStyle style = self.traitCollection.userInterfaceStyle;
-        if (self.appearanceMode == DWAlertAppearanceModeAutomatic) {
-            DWAlertAppearanceMode appearanceMode = DWAlertAppearanceModeForUIInterfaceStyle(style);
-            [self updateAppearanceForMode:appearanceMode];
-        }
+    if (self.appearanceMode == DWAlertAppearanceModeAutomatic) {
+        [self updateAppearanceForMode:DWAlertAppearanceModeAutomatic];
     }
 }
 
@@ -293,7 +301,20 @@ NS_ASSUME_NONNULL_BEGIN
     self.actionsStackView.preferredAction = preferredAction;
 }
 
+- (void)setupTitle:(nullable NSString *)title message:(nullable NSString *)message {
+    NSAssert(self.contentViewChildView == nil, @"Title and message can't be combined with a child view");
+
+    DWAlertTitleMessageView *titleMessageView = [[DWAlertTitleMessageView alloc] initWithTitle:title message:message];
+    [self.contentView addSubview:titleMessageView];
+    self.titleMessageView = titleMessageView;
+    self.contentViewHeightConstraint.active = YES;
+
+    [self setNeedsLayout];
+}
+
 - (void)setupChildView:(UIView *)childView {
+    NSAssert(self.titleMessageView == nil, @"Child view can't be combined with title and message");
+
     self.contentViewChildView = childView;
 
     childView.translatesAutoresizingMaskIntoConstraints = NO;
@@ -316,18 +337,68 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)addAction:(DWAlertAction *)action {
     DWAlertViewActionBaseView *button = [[self.actionViewClass alloc] initWithAlertAction:action];
-    button.normalTintColor = self.normalTintColor;
-    button.disabledTintColor = self.disabledTintColor;
-    button.destructiveTintColor = self.destructiveTintColor;
+    [self applyTintColorsToActionView:button];
     [self.actionsStackView addActionButton:button];
 }
 
+- (void)setupActions:(NSArray<DWAlertAction *> *)actions {
+    NSMutableArray<DWAlertViewActionBaseView *> *reusableButtons = [self.actionsStackView.arrangedSubviews mutableCopy];
+    NSMutableArray<DWAlertViewActionBaseView *> *buttons = [NSMutableArray arrayWithCapacity:actions.count];
+    for (DWAlertAction *action in actions) {
+        DWAlertViewActionBaseView *button = [self dequeueReusableButtonForAction:action fromButtons:reusableButtons];
+        if (button) {
+            [reusableButtons removeObject:button];
+            if (button.alertAction != action) {
+                button.alertAction = action;
+            }
+        }
+        else {
+            button = [[self.actionViewClass alloc] initWithAlertAction:action];
+            [self applyTintColorsToActionView:button];
+        }
+        [buttons addObject:button];
+    }
+
+    [self.actionsStackView setActionButtons:buttons];
+}
+
 - (void)resetActionsState {
     [self.actionsStackView resetActionsState];
 }
 
-- (void)removeAllActions {
-    [self.actionsStackView removeAllActions];
+- (void)measureTextsWithCompletion:(void (^__nullable)(void))completion {
+    NSMutableArray<NSString *> *actionTitles = [NSMutableArray array];
+    for (DWAlertViewActionBaseView *actionView in self.actionsStackView.arrangedSubviews) {
+        NSString *title = actionView.alertAction.title;
+        if (title) {
+            [actionTitles addObject:title];
+        }
+    }
+
+    DWAlertTitleMessageView *titleMessageView = self.titleMessageView;
+    __weak typeof(self) weakSelf = self;
+    [DWAlertMeasurement measureTitle:titleMessageView.title
+                             message:titleMessageView.message
+                        actionTitles:actionTitles
+                          completion:^(DWAlertMeasurement *measurement) {
+                              __strong typeof(weakSelf) strongSelf = weakSelf;
+                              if (strongSelf && measurement.isValidForCurrentEnvironment) {
+                                  [strongSelf applyMeasurement:measurement];
+                              }
+
+                              if (completion) {
+                                  completion();
+                              }
+                          }];
+}
+
+- (void)setActivityIndicatorVisible:(BOOL)visible forAction:(DWAlertAction *)action {
+    for (DWAlertViewActionBaseView *actionView in self.actionsStackView.arrangedSubviews) {
+        if (actionView.alertAction == action) {
+            actionView.activityIndicatorVisible = visible;
+            break;
+        }
+    }
 }
 
 - (void)setAppearanceMode:(DWAlertAppearanceMode)appearanceMode {
@@ -336,42 +407,42 @@ NS_ASSUME_NONNULL_BEGIN
     [self updateAppearanceForMode:appearanceMode];
 }
 
-- (void)setNormalTintColor:(UIColor *)normalTintColor {
+- (UIColor *)normalTintColor {
+    return _normalTintColor ?: self.theme.normalTintColor;
+}
+
+- (void)setNormalTintColor:(nullable UIColor *)normalTintColor {
     _normalTintColor = normalTintColor;
+    [self setNeedsUpdateActionsTintColors];
+}
 
-    for (DWAlertViewActionBaseView *actionView in self.actionsStackView.arrangedSubviews) {
-        actionView.normalTintColor = normalTintColor;
-    }
+- (UIColor *)disabledTintColor {
+    return _disabledTintColor ?: self.theme.disabledTintColor;
 }
 
-- (void)setDisabledTintColor:(UIColor *)disabledTintColor {
+- (void)setDisabledTintColor:(nullable UIColor *)disabledTintColor {
     _disabledTintColor = disabledTintColor;
+    [self setNeedsUpdateActionsTintColors];
+}
 
-    for (DWAlertViewActionBaseView *actionView in self.actionsStackView.arrangedSubviews) {
-        actionView.disabledTintColor = disabledTintColor;
-    }
+- (UIColor *)destructiveTintColor {
+    return _destructiveTintColor ?: self.theme.destructiveTintColor;
 }
 
-- (void)setDestructiveTintColor:(UIColor *)destructiveTintColor {
+- (void)setDestructiveTintColor:(nullable UIColor *)destructiveTintColor {
     _destructiveTintColor = destructiveTintColor;
-
-    for (DWAlertViewActionBaseView *actionView in self.actionsStackView.arrangedSubviews) {
-        actionView.destructiveTintColor = destructiveTintColor;
-    }
+    [self setNeedsUpdateActionsTintColors];
 }
 
 #pragma mark - DWActionsStackViewDelegate
 
 - (void)actionsStackViewDidUpdateLayout:(DWActionsStackView *)view {
-    const CGFloat actionButtonHeight = DWAlertViewActionButtonCurrentMinHeight();
-    if (self.actionsStackView.axis == UILayoutConstraintAxisHorizontal) {
-        self.actionsStackViewHeightConstraint.constant = actionButtonHeight;
-    }
-    else {
-        const NSUInteger actionsCount = self.actionsStackView.arrangedSubviews.count;
-        const CGFloat constant = actionsCount * actionButtonHeight + (actionsCount - 1) * DWAlertViewSeparatorSize();
-        self.actionsStackViewHeightConstraint.constant = constant;
-    }
+    const NSUInteger actionsCount = self.actionsStackView.arrangedSubviews.count;
+    self.actionsStackViewHeightConstraint.constant =
+        DWAlertGeometryActionsHeight(actionsCount,
+                                     [self geometryActionsAxis],
+                                     DWAlertViewActionButtonCurrentMinHeight(),
+                                     DWAlertViewSeparatorSize());
 
     [self setNeedsLayout];
 }
@@ -399,14 +470,41 @@ NS_ASSUME_NONNULL_BEGIN
 #pragma mark - UIScrollViewDelegate
 
 - (void)scrollViewDidScroll:(UIScrollView *)scrollView {
+    if (scrollView == self.contentScrollView) {
+        [self updateVisibleContentRect];
+
+        return;
+    }
+
     // sync scrolling of actions and action separators underneath
     CGRect scrollViewBounds = scrollView.bounds;
     scrollViewBounds.origin.y = scrollView.contentOffset.y;
     self.effectsScrollView.bounds = scrollViewBounds;
+
+    if (self.effectsScrollView.hidden) {
+        return;
+    }
+
+    // rebuild separators only when the visible area leaves the rendered one
+    const CGRect contentRect = {CGPointZero, scrollView.contentSize};
+    const CGRect visibleRect = CGRectIntersection(scrollViewBounds, contentRect);
+    if (!CGRectIsEmpty(visibleRect) && !CGRectContainsRect(self.separatorsRenderedRect, visibleRect)) {
+        [self renderSeparatorsInRect:[self separatorsRenderingRectForContentOffset:scrollView.contentOffset]];
+    }
 }
 
 #pragma mark - Private
 
+- (void)applyMeasurement:(DWAlertMeasurement *)measurement {
+    [self.titleMessageView setMeasuredTitleHeight:measurement.titleHeight
+                                    messageHeight:measurement.messageHeight
+                                         forWidth:measurement.textWidth
+                              contentSizeCategory:measurement.contentSizeCategory];
+    self.actionsStackView.measurement = measurement;
+
+    [self setNeedsLayout];
+}
+
 - (void)updateSeparatorsLayoutIgnoringRect:(CGRect)ignoringRect {
     const NSUInteger actionsCount = self.actionsStackView.arrangedSubviews.count;
     if (actionsCount == 0) {
@@ -426,35 +524,100 @@ NS_ASSUME_NONNULL_BEGIN
     self.effectsScrollView.hidden = NO;
     self.effectsScrollView.frame = self.actionsScrollView.frame;
     self.effectsScrollView.contentSize = actionsContentSize;
-    self.separatorView.frame = CGRectMake(0.0, 0.0, actionsContentSize.width, actionsContentSize.height);
 
+    self.separatorsIgnoringRect = ignoringRect;
+    [self renderSeparatorsInRect:[self separatorsRenderingRectForContentOffset:self.actionsScrollView.contentOffset]];
+}
+
+/**
+ Visible part of the actions extended by the rendering margin, in `effectsScrollView` coordinates
+ */
+- (CGRect)separatorsRenderingRectForContentOffset:(CGPoint)contentOffset {
+    const CGSize contentSize = self.actionsScrollView.contentSize;
+    const CGFloat visibleHeight = CGRectGetHeight(self.actionsScrollView.bounds);
+    const CGFloat margin = visibleHeight * DWAlertViewSeparatorsRenderingMarginRatio;
+    const CGFloat minY = MAX(0.0, contentOffset.y - margin);
+    const CGFloat maxY = MIN(contentSize.height, contentOffset.y + visibleHeight + margin);
+
+    return CGRectMake(0.0, minY, contentSize.width, MAX(0.0, maxY - minY));
+}
+
+/**
+ Builds separators intersecting `rect` only, so the size of the shape layer doesn't depend on actions count
+ */
+- (void)renderSeparatorsInRect:(CGRect)rect {
+    self.separatorsRenderedRect = rect;
+    self.separatorView.frame = rect;
+
+    const NSUInteger actionsCount = self.actionsStackView.arrangedSubviews.count;
+    if (actionsCount == 0) {
+        self.separatorView.visiblePath = nil;
+
+        return;
+    }
+
+    const CGFloat width = CGRectGetWidth(self.bounds);
+    const CGFloat separatorSize = DWAlertViewSeparatorSize();
     const CGFloat actionButtonHeight = DWAlertViewActionButtonCurrentMinHeight();
-    const NSUInteger separatorsCount = actionsCount - 1;
+    const DWAlertGeometryAxis axis = [self geometryActionsAxis];
+    const DWAlertGeometryRect renderingRect = DWAlertGeometryRectFromCGRect(rect);
+    const DWAlertGeometryRect ignoringRect = DWAlertGeometryRectFromCGRect(self.separatorsIgnoringRect);
+    const DWAlertGeometryRange range = DWAlertGeometrySeparatorsInRect(renderingRect,
+                                                                       actionsCount,
+                                                                       axis,
+                                                                       width,
+                                                                       actionButtonHeight,
+                                                                       separatorSize);
     UIBezierPath *path = [UIBezierPath bezierPath];
-    CGFloat y = 0.0;
-    if (self.actionsStackView.axis == UILayoutConstraintAxisHorizontal) {
-        const CGFloat distance = size.width / actionsCount - separatorSize * separatorsCount;
-        CGFloat x = distance;
-        for (NSUInteger i = 0; i < separatorsCount; i++) {
-            const CGRect separator = CGRectMake(x, y, separatorSize, actionButtonHeight);
-            if (!CGRectContainsRect(ignoringRect, separator)) {
-                [path appendPath:[UIBezierPath bezierPathWithRect:separator]];
-            }
-            x += distance + separatorSize;
+    for (size_t i = range.location; i < range.location + range.length; i++) {
+        const DWAlertGeometryRect separator =
+            DWAlertGeometrySeparatorRect(i, actionsCount, axis, width, actionButtonHeight, separatorSize);
+        if (!DWAlertGeometryRectContainsRect(ignoringRect, separator)) {
+            const CGRect separatorRect = CGRectMake(separator.x - renderingRect.x,
+                                                    separator.y - renderingRect.y,
+                                                    separator.width,
+                                                    separator.height);
+            [path appendPath:[UIBezierPath bezierPathWithRect:separatorRect]];
         }
     }
-    else {
-        y += actionButtonHeight;
-        for (NSUInteger i = 0; i < separatorsCount; i++) {
-            const CGRect separator = CGRectMake(0.0, y, size.width, separatorSize);
-            if (!CGRectContainsRect(ignoringRect, separator)) {
-                [path appendPath:[UIBezierPath bezierPathWithRect:separator]];
+
+    self.separatorView.visiblePath = path;
+}
+
+- (DWAlertGeometryAxis)geometryActionsAxis {
+    return self.actionsStackView.axis == UILayoutConstraintAxisHorizontal ? DWAlertGeometryAxisHorizontal
+                                                                          : DWAlertGeometryAxisVertical;
+}
+
+- (void)updateVisibleContentRect {
+    UIView *childView = self.contentViewChildView;
+    if (![childView conformsToProtocol:@protocol(DWAlertViewVisibleContentObserving)]) {
+        return;
+    }
+
+    UIScrollView *scrollView = self.contentScrollView;
+    const CGRect visibleRect = [scrollView convertRect:scrollView.bounds toView:childView];
+    [(id<DWAlertViewVisibleContentObserving>)childView alertView:self didChangeVisibleContentRect:visibleRect];
+}
+
+- (nullable DWAlertViewActionBaseView *)dequeueReusableButtonForAction:(DWAlertAction *)action
+                                                             fromButtons:(NSArray<DWAlertViewActionBaseView *> *)buttons {
+    for (DWAlertViewActionBaseView *button in buttons) {
+        if (button.alertAction == action) {
+            return button;
+        }
+    }
+
+    NSString *identifier = action.identifier;
+    if (identifier) {
+        for (DWAlertViewActionBaseView *button in buttons) {
+            if ([button.alertAction.identifier isEqualToString:identifier]) {
+                return button;
             }
-            y += actionButtonHeight + separatorSize;
         }
     }
 
-    self.separatorView.visiblePath = path;
+    return nil;
 }
 
 - (void)enterKeyCommandAction:(UIKeyCommand *)sender {
@@ -466,17 +629,49 @@ NS_ASSUME_NONNULL_BEGIN
 }
 
 - (void)updateAppearanceForMode:(DWAlertAppearanceMode)appearanceMode {
-    UIBlurEffect *blurEffect = DWAlertViewBlurEffect(appearanceMode);
-    self.blurEffectView.effect = blurEffect;
+    DWAlertViewTheme *theme = [DWAlertViewTheme themeForAppearanceMode:appearanceMode
+                                                       traitCollection:self.traitCollection];
+    [self applyTheme:theme];
+}
 
-    UIVibrancyEffect *vibrancyEffect = [UIVibrancyEffect effectForBlurEffect:blurEffect];
-    self.vibrancyEffectView.effect = vibrancyEffect;
+- (void)applyTheme:(DWAlertViewTheme *)theme {
+    // Themes are shared between alerts, nothing to do if it's already applied
+    if (self.theme == theme) {
+        return;
+    }
+    self.theme = theme;
+
+    self.backgroundView.backgroundColor = theme.backgroundViewColor;
+    self.blurEffectView.effect = theme.blurEffect;
+    self.vibrancyEffectView.effect = theme.vibrancyEffect;
+    self.contentActionsSeparatorView.backgroundColor = theme.separatorColor;
+    self.separatorView.dimmingColor = theme.separatorColor;
+    self.actionTouchHighlightView.backgroundColor = theme.actionTouchHighlightColor;
+
+    // default tint colors might be changed along with the theme
+    [self setNeedsUpdateActionsTintColors];
+}
+
+- (void)setNeedsUpdateActionsTintColors {
+    self.needsUpdateActionsTintColors = YES;
+    [self setNeedsLayout];
+}
+
+- (void)updateActionsTintColorsIfNeeded {
+    if (!self.needsUpdateActionsTintColors) {
+        return;
+    }
+    self.needsUpdateActionsTintColors = NO;
 
-    UIColor *separatorColor = DWAlertViewSeparatorColor(appearanceMode);
-    self.contentActionsSeparatorView.backgroundColor = separatorColor;
-    self.separatorView.dimmingColor = separatorColor;
+    for (DWAlertViewActionBaseView *actionView in self.actionsStackView.arrangedSubviews) {
+        [self applyTintColorsToActionView:actionView];
+    }
+}
 
-    self.actionTouchHighlightView.backgroundColor = DWAlertViewActionTouchHighlightColor(appearanceMode);
+- (void)applyTintColorsToActionView:(DWAlertViewActionBaseView *)actionView {
+    actionView.normalTintColor = self.normalTintColor;
+    actionView.disabledTintColor = self.disabledTintColor;
+    actionView.destructiveTintColor = self.destructiveTintColor;
 }
 
 @end
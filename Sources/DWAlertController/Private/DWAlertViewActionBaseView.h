@@ -37,8 +37,18 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @interface DWAlertViewActionBaseView : UIView
 
-@property (readonly, strong, nonatomic) DWAlertAction *alertAction;
+/**
+ Action could be replaced with an updated one (e.g. with a different title) to reuse the view.
+ Subclasses should override the setter to update its appearance.
+ */
+@property (strong, nonatomic) DWAlertAction *alertAction;
 @property (assign, nonatomic, getter=isPreferred) BOOL preferred;
+
+/**
+ Displays activity indicator in the center of the view.
+ Subclasses should override the setter to hide its content while the indicator is visible.
+ */
+@property (assign, nonatomic, getter=isActivityIndicatorVisible) BOOL activityIndicatorVisible;
 @property (nullable, weak, nonatomic) id<DWAlertViewActionBaseViewDelegate> delegate;
 
 @property (strong, nonatomic) UIColor *normalTintColor;
@@ -22,6 +22,12 @@ NS_ASSUME_NONNULL_BEGIN
 static void *DWAlertViewActionBaseViewKVOContext = &DWAlertViewActionBaseViewKVOContext;
 static NSString *const AlertActionEnabledKeyPath = @"alertAction.enabled";
 
+@interface DWAlertViewActionBaseView ()
+
+@property (nullable, strong, nonatomic) UIActivityIndicatorView *activityIndicatorView;
+
+@end
+
 @implementation DWAlertViewActionBaseView
 
 - (instancetype)initWithAlertAction:(DWAlertAction *)alertAction {
@@ -50,6 +56,43 @@ static NSString *const AlertActionEnabledKeyPath = @"alertAction.enabled";
                  context:DWAlertViewActionBaseViewKVOContext];
 }
 
+- (void)setAlertAction:(DWAlertAction *)alertAction {
+    _alertAction = alertAction;
+
+    self.accessibilityLabel = alertAction.title;
+}
+
+- (void)setActivityIndicatorVisible:(BOOL)activityIndicatorVisible {
+    _activityIndicatorVisible = activityIndicatorVisible;
+
+    if (activityIndicatorVisible) {
+        UIActivityIndicatorView *activityIndicatorView = self.activityIndicatorView;
+        if (!activityIndicatorView) {
+            UIActivityIndicatorViewStyle style;
+            if (@available(iOS 13.0, *)) {
+                style = UIActivityIndicatorViewStyleMedium;
+            }
+            else {
+                style = UIActivityIndicatorViewStyleGray;
+            }
+            activityIndicatorView = [[UIActivityIndicatorView alloc] initWithActivityIndicatorStyle:style];
+            activityIndicatorView.autoresizingMask = UIViewAutoresizingFlexibleLeftMargin |
+                                                     UIViewAutoresizingFlexibleRightMargin |
+                                                     UIViewAutoresizingFlexibleTopMargin |
+                                                     UIViewAutoresizingFlexibleBottomMargin;
+            activityIndicatorView.center = CGPointMake(CGRectGetMidX(self.bounds), CGRectGetMidY(self.bounds));
+            [self addSubview:activityIndicatorView];
+            self.activityIndicatorView = activityIndicatorView;
+        }
+        [activityIndicatorView startAnimating];
+    }
+    else {
+        [self.activityIndicatorView stopAnimating];
+        [self.activityIndicatorView removeFromSuperview];
+        self.activityIndicatorView = nil;
+    }
+}
+
 - (void)updateForCurrentContentSizeCategory {
 }
 
@@ -21,6 +21,13 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@interface UIFont (DWAlertViewActionButtonHelper)
+
++ (UIFont *)dw_alertTitleFont;
++ (UIFont *)dw_alertPreferredTitleFont;
+
+@end
+
 /**
  A view for DWAlertAction
  */
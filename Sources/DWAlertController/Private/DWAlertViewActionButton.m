@@ -80,7 +80,6 @@ NS_ASSUME_NONNULL_BEGIN
 
 static NSLineBreakMode const LineBreakMode = NSLineBreakByTruncatingMiddle;
 static NSTextAlignment const TextAlignment = NSTextAlignmentCenter;
-static CGFloat const MinimumScaleFactor = 0.58;
 
 @interface DWAlertViewActionButton ()
 
@@ -100,7 +99,7 @@ static CGFloat const MinimumScaleFactor = 0.58;
         titleLabel.lineBreakMode = LineBreakMode;
         titleLabel.textAlignment = TextAlignment;
         titleLabel.adjustsFontSizeToFitWidth = YES;
-        titleLabel.minimumScaleFactor = MinimumScaleFactor;
+        titleLabel.minimumScaleFactor = DWAlertViewActionTitleMinimumScaleFactor;
         titleLabel.text = self.alertAction.title;
         [self addSubview:titleLabel];
         _titleLabel = titleLabel;
@@ -135,6 +134,24 @@ static CGFloat const MinimumScaleFactor = 0.58;
     }
 }
 
+- (void)setAlertAction:(DWAlertAction *)alertAction {
+    [super setAlertAction:alertAction];
+
+    self.titleLabel.text = alertAction.title;
+    if (alertAction.style == DWAlertActionStyleDestructive) {
+        self.titleLabel.highlightedTextColor = self.destructiveTintColor;
+    }
+    else {
+        self.titleLabel.highlightedTextColor = self.normalTintColor;
+    }
+}
+
+- (void)setActivityIndicatorVisible:(BOOL)activityIndicatorVisible {
+    [super setActivityIndicatorVisible:activityIndicatorVisible];
+
+    self.titleLabel.hidden = activityIndicatorVisible;
+}
+
 - (void)setNormalTintColor:(UIColor *)normalTintColor {
     [super setNormalTintColor:normalTintColor];
 
@@ -0,0 +1,31 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "DWAlertViewActionBaseView.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Lightweight alternative to `DWAlertViewActionButton`.
+ The title is a plain layer showing an image from `DWAlertActionTitleCache` and the view is laid out by frame.
+ Title scaling and middle truncation match `DWAlertViewActionButton`.
+ */
+@interface DWAlertViewActionLayerView : DWAlertViewActionBaseView
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,196 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "DWAlertViewActionLayerView.h"
+
+#import "DWAlertActionTitleCache.h"
+#import "DWAlertInternalConstants.h"
+#import "DWAlertViewActionButton.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface DWAlertViewActionLayerView ()
+
+@property (readonly, strong, nonatomic) CALayer *titleLayer;
+@property (strong, nonatomic) UIFont *titleFont;
+
+@end
+
+@implementation DWAlertViewActionLayerView
+
+- (instancetype)initWithAlertAction:(DWAlertAction *)alertAction {
+    self = [super initWithAlertAction:alertAction];
+    if (self) {
+        CALayer *titleLayer = [CALayer layer];
+        // contents and frame are changed along with the view, no implicit animations needed
+        titleLayer.actions = @{
+            @"contents" : [NSNull null],
+            @"bounds" : [NSNull null],
+            @"position" : [NSNull null],
+            @"hidden" : [NSNull null],
+        };
+        [self.layer addSublayer:titleLayer];
+        _titleLayer = titleLayer;
+
+        _titleFont = [UIFont dw_alertTitleFont];
+
+        [self updateEnabledState];
+    }
+    return self;
+}
+
+- (CGSize)intrinsicContentSize {
+    NSString *title = self.alertAction.title;
+    const UIContentSizeCategory category = [UIApplication sharedApplication].preferredContentSizeCategory;
+    const CGFloat padding = DWAlertViewActionButtonTitlePadding(category);
+    CGSize size = CGSizeMake(0.0, ceil(self.titleFont.lineHeight));
+    if (title.length > 0) {
+        size = [[DWAlertActionTitleCache sharedCache] sizeForTitle:title font:self.titleFont];
+    }
+    size.height += padding * 2.0;
+
+    return size;
+}
+
+- (void)layoutSubviews {
+    [super layoutSubviews];
+
+    [self updateTitleLayer];
+}
+
+- (void)traitCollectionDidChange:(nullable UITraitCollection *)previousTraitCollection {
+    [super traitCollectionDidChange:previousTraitCollection];
+
+    // tint colors might be dynamic
+    [self setNeedsLayout];
+}
+
+- (void)setPreferred:(BOOL)preferred {
+    [super setPreferred:preferred];
+
+    [self updateTitleFont];
+}
+
+- (void)setAlertAction:(DWAlertAction *)alertAction {
+    [super setAlertAction:alertAction];
+
+    [self invalidateIntrinsicContentSize];
+    [self setNeedsLayout];
+}
+
+- (void)setActivityIndicatorVisible:(BOOL)activityIndicatorVisible {
+    [super setActivityIndicatorVisible:activityIndicatorVisible];
+
+    self.titleLayer.hidden = activityIndicatorVisible;
+}
+
+- (void)setNormalTintColor:(UIColor *)normalTintColor {
+    [super setNormalTintColor:normalTintColor];
+
+    [self setNeedsLayout];
+}
+
+- (void)setDisabledTintColor:(UIColor *)disabledTintColor {
+    [super setDisabledTintColor:disabledTintColor];
+
+    [self setNeedsLayout];
+}
+
+- (void)setDestructiveTintColor:(UIColor *)destructiveTintColor {
+    [super setDestructiveTintColor:destructiveTintColor];
+
+    [self setNeedsLayout];
+}
+
+- (void)updateForCurrentContentSizeCategory {
+    [self updateTitleFont];
+}
+
+- (void)updateEnabledState {
+    [super updateEnabledState];
+
+    [self setNeedsLayout];
+}
+
+#pragma mark - Private
+
+- (void)updateTitleFont {
+    self.titleFont = self.preferred ? [UIFont dw_alertPreferredTitleFont] : [UIFont dw_alertTitleFont];
+
+    [self invalidateIntrinsicContentSize];
+    [self setNeedsLayout];
+}
+
+- (nullable UIColor *)currentTitleColor {
+    UIColor *color = nil;
+    if (!self.alertAction.enabled) {
+        color = self.disabledTintColor;
+    }
+    else if (self.alertAction.style == DWAlertActionStyleDestructive) {
+        color = self.destructiveTintColor;
+    }
+    else {
+        color = self.normalTintColor;
+    }
+
+    if (@available(iOS 13.0, *)) {
+        color = [color resolvedColorWithTraitCollection:self.traitCollection];
+    }
+
+    return color;
+}
+
+- (void)updateTitleLayer {
+    NSString *title = self.alertAction.title;
+    UIColor *color = [self currentTitleColor];
+    const CGRect bounds = self.bounds;
+    const CGFloat availableWidth = CGRectGetWidth(bounds);
+    if (title.length == 0 || !color || availableWidth <= 0.0) {
+        self.titleLayer.contents = nil;
+
+        return;
+    }
+
+    DWAlertActionTitleCache *cache = [DWAlertActionTitleCache sharedCache];
+
+    // Shrink the font down to the minimum scale factor and truncate the rest (as UILabel does)
+    UIFont *font = self.titleFont;
+    CGFloat maxWidth = 0.0;
+    const CGFloat naturalWidth = [cache sizeForTitle:title font:font].width;
+    if (naturalWidth > availableWidth) {
+        const CGFloat scaleFactor = MAX(DWAlertViewActionTitleMinimumScaleFactor, availableWidth / naturalWidth);
+        font = [font fontWithSize:floor(font.pointSize * scaleFactor)];
+        if ([cache sizeForTitle:title font:font].width > availableWidth) {
+            maxWidth = availableWidth;
+        }
+    }
+
+    const CGFloat scale = self.window.screen.scale ?: [UIScreen mainScreen].scale;
+    UIImage *image = [cache imageForTitle:title font:font color:color scale:scale maxWidth:maxWidth];
+    const CGSize imageSize = image.size;
+
+    self.titleLayer.contents = (__bridge id)image.CGImage;
+    self.titleLayer.contentsScale = image.scale;
+    self.titleLayer.frame = CGRectMake(round((CGRectGetWidth(bounds) - imageSize.width) / 2.0 * scale) / scale,
+                                       round((CGRectGetHeight(bounds) - imageSize.height) / 2.0 * scale) / scale,
+                                       imageSize.width,
+                                       imageSize.height);
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
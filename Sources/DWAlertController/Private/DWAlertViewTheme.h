@@ -0,0 +1,57 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+#import "DWAlertController/DWAlertAppearanceMode.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Immutable set of resolved colors and effects used by the alert for a single appearance mode.
+ Instances are created once per mode and shared between all alerts.
+ */
+@interface DWAlertViewTheme : NSObject
+
+@property (readonly, strong, nonatomic) UIBlurEffect *blurEffect;
+@property (readonly, strong, nonatomic) UIVibrancyEffect *vibrancyEffect;
+@property (readonly, strong, nonatomic) UIColor *backgroundViewColor;
+@property (readonly, strong, nonatomic) UIColor *separatorColor;
+@property (readonly, strong, nonatomic) UIColor *actionTouchHighlightColor;
+@property (readonly, assign, nonatomic) float dimmingOpacity;
+
+@property (readonly, strong, nonatomic) UIColor *normalTintColor;
+@property (readonly, strong, nonatomic) UIColor *disabledTintColor;
+@property (readonly, strong, nonatomic) UIColor *destructiveTintColor;
+
+/**
+ Shared theme for the appearance mode. `DWAlertAppearanceModeAutomatic` resolves to the light theme.
+ */
++ (instancetype)themeForAppearanceMode:(DWAlertAppearanceMode)appearanceMode;
+
+/**
+ Shared theme for the appearance mode. `DWAlertAppearanceModeAutomatic` follows the interface style
+ of the trait collection on iOS 12 or higher and resolves to the light theme otherwise.
+ */
++ (instancetype)themeForAppearanceMode:(DWAlertAppearanceMode)appearanceMode
+                       traitCollection:(UITraitCollection *)traitCollection;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,69 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "DWAlertViewTheme.h"
+
+#import "DWAlertInternalConstants.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation DWAlertViewTheme
+
++ (instancetype)themeForAppearanceMode:(DWAlertAppearanceMode)appearanceMode {
+    static DWAlertViewTheme *lightTheme = nil;
+    static DWAlertViewTheme *darkTheme = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        lightTheme = [[self alloc] initWithAppearanceMode:DWAlertAppearanceModeLight];
+        darkTheme = [[self alloc] initWithAppearanceMode:DWAlertAppearanceModeDark];
+    });
+
+    return appearanceMode == DWAlertAppearanceModeDark ? darkTheme : lightTheme;
+}
+
++ (instancetype)themeForAppearanceMode:(DWAlertAppearanceMode)appearanceMode
+                       traitCollection:(UITraitCollection *)traitCollection {
+    if (appearanceMode == DWAlertAppearanceModeAutomatic) {
+        if (@available(iOS 12.0, *)) {
+            const UIUserInterfaceStyle interfaceStyle = traitCollection.userInterfaceStyle;
+            appearanceMode = DWAlertAppearanceModeForUIInterfaceStyle(interfaceStyle);
+        }
+    }
+
+    return [self themeForAppearanceMode:appearanceMode];
+}
+
+- (instancetype)initWithAppearanceMode:(DWAlertAppearanceMode)appearanceMode {
+    self = [super init];
+    if (self) {
+        _blurEffect = DWAlertViewBlurEffect(appearanceMode);
+        _vibrancyEffect = [UIVibrancyEffect effectForBlurEffect:_blurEffect];
+        _backgroundViewColor = DWAlertViewBackgroundViewColor();
+        _separatorColor = DWAlertViewSeparatorColor(appearanceMode);
+        _actionTouchHighlightColor = DWAlertViewActionTouchHighlightColor(appearanceMode);
+        _dimmingOpacity = DWAlertDimmingOpacity(appearanceMode);
+
+        _normalTintColor = DWAlertViewNormalTextColor();
+        _disabledTintColor = DWAlertViewDisabledTextColor();
+        _destructiveTintColor = DWAlertViewDestructiveTextColor();
+    }
+    return self;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
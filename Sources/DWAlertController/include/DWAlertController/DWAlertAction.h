@@ -25,16 +25,66 @@ typedef NS_ENUM(NSInteger, DWAlertActionStyle) {
     DWAlertActionStyleDestructive,
 } NS_SWIFT_NAME(DWAlertAction.Style);
 
+@class DWAlertAction;
+
+/**
+ Handler of asynchronous action. `completion` must be called exactly once when the work is done,
+ it can be called from any thread.
+ */
+typedef void (^DWAlertActionAsyncHandler)(DWAlertAction *action, dispatch_block_t completion);
+
 @interface DWAlertAction : NSObject
 
 @property (nullable, readonly, copy, nonatomic) NSString *title;
 @property (readonly, assign, nonatomic) DWAlertActionStyle style;
 @property (assign, nonatomic, getter=isEnabled) BOOL enabled;
 
+/**
+ Optional identifier of the action.
+ When actions are re-set with `setupActions:`, an action matches the existing one with the same identifier
+ and its button is reused and updated in place instead of being recreated.
+ */
+@property (nullable, copy, nonatomic) NSString *identifier;
+
 + (instancetype)actionWithTitle:(nullable NSString *)title
                           style:(DWAlertActionStyle)style
                         handler:(void (^__nullable)(DWAlertAction *action))handler;
 
+/**
+ Create an action with asynchronous handler.
+
+ While the handler is running the other actions of the alert are disabled and
+ (if `showsActivityIndicator` is set) the action displays an activity indicator.
+ When it finishes, the actions are enabled again unless their `enabled` was changed in the meantime.
+ The alert is dismissed once the handler calls its completion.
+ The handler is called on `handlerQueue`, off the main thread by default.
+ */
++ (instancetype)actionWithTitle:(nullable NSString *)title
+                          style:(DWAlertActionStyle)style
+                   asyncHandler:(DWAlertActionAsyncHandler)asyncHandler;
+
+/**
+ The queue to call asynchronous handler on. Global queue with `QOS_CLASS_USER_INITIATED` by default.
+ Set the main queue if the handler has to deal with UI.
+ */
+@property (null_resettable, strong, nonatomic) dispatch_queue_t handlerQueue;
+
+/**
+ Whether the action displays activity indicator while asynchronous handler is running. Defaults to YES.
+ */
+@property (assign, nonatomic) BOOL showsActivityIndicator;
+
+/**
+ YES while asynchronous handler is running
+ */
+@property (readonly, assign, nonatomic, getter=isExecuting) BOOL executing;
+
+/**
+ Time from the tap on the action until its handler has finished for the last run of the handler.
+ Zero if the handler has never been called.
+ */
+@property (readonly, assign, nonatomic) NSTimeInterval lastHandlerDuration;
+
 - (instancetype)init NS_UNAVAILABLE;
 
 @end
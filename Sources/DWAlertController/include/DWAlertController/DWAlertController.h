@@ -19,11 +19,13 @@
 
 #import "DWAlertAction.h"
 #import "DWAlertAppearanceMode.h"
+#import "DWAlertLongTextContentController.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
 /**
  Custom implementation of `UIAlertController` with a child controller instead of title / message.
+ Plain title / message alerts are also supported.
  */
 @interface DWAlertController : UIViewController <UIAppearance>
 
@@ -42,6 +44,23 @@ NS_ASSUME_NONNULL_BEGIN
  */
 + (instancetype)alertControllerWithContentController:(__kindof UIViewController *)contentController;
 
+/**
+ Configure alert with title and message.
+ The texts are drawn directly by the alert without a child content controller which makes
+ this kind of alerts considerably cheaper to create and lay out.
+ Such alert can't be transitioned to a content controller.
+
+ @param title The title of the alert
+ @param message Descriptive text that provides additional details
+ @return Configured DWAlertController object
+ */
+- (instancetype)initWithTitle:(nullable NSString *)title message:(nullable NSString *)message NS_DESIGNATED_INITIALIZER;
+
+/**
+ Convinience initializer
+ */
++ (instancetype)alertControllerWithTitle:(nullable NSString *)title message:(nullable NSString *)message;
+
 /**
  Child content controller. Any subclass of `UIViewController`.
  */
@@ -56,10 +75,58 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)performTransitionToContentController:(UIViewController *)controller animated:(BOOL)animated NS_SWIFT_NAME(performTransition(toContentController:animated:));
 
+/**
+ Show the alert in a dedicated overlay window above the app's windows instead of presenting it
+ from a view controller. The alert is presented from the overlay window's own root controller, so it can be shown
+ while another modal controller is presented or from the code which has no access to view controllers.
+ Status bar appearance and rotation follow the root view controller of the app's key window.
+ The overlay window is shared between alerts and is hidden after the last of them is dismissed.
+ Dismiss the alert as usual with `dismissViewControllerAnimated:completion:`.
+ The alert must be created and configured on the main thread. Only this call may come from a background
+ thread, in that case the presentation is performed asynchronously on the main thread.
+
+ @param animated Whether presentation should be animated
+ @param completion The block to execute after the alert is presented
+ */
+- (void)showAnimated:(BOOL)animated completion:(void (^__nullable)(void))completion NS_SWIFT_NAME(show(animated:completion:));
+
+/**
+ Replace this alert with another alert without the full dismissal and presentation round trip.
+ The alert is removed immediately and the dimming of the background is handed off to the new alert,
+ so only the appearance of the new alert is animated.
+ If the alert is being presented or dismissed at the moment, the running transition is finished right away.
+
+ @param alertController The alert to present instead of the receiver
+ @param completion The block to execute after the new alert is presented
+ */
+- (void)replaceWithAlertController:(DWAlertController *)alertController
+                        completion:(void (^__nullable)(void))completion NS_SWIFT_NAME(replace(with:completion:));
+
 @property (readonly, copy, nonatomic) NSArray<DWAlertAction *> *actions;
 - (void)addAction:(DWAlertAction *)action;
+
+/**
+ Re-set actions of the alert.
+ Existing action buttons are reused for the same actions (or the actions with the same `identifier`),
+ only changed buttons are inserted, removed or moved.
+ */
 - (void)setupActions:(NSArray<DWAlertAction *> *)actions;
 
+/**
+ Re-set actions of the alert animating the change of the alert height if it's visible.
+ */
+- (void)setupActions:(NSArray<DWAlertAction *> *)actions animated:(BOOL)animated;
+
+/**
+ Measure title, message and action titles of the alert on a background queue.
+ The result is attached to the alert, so presenting it doesn't require text measurement on the main thread.
+ Call after the alert is configured; the measurement is discarded if content size category changes
+ before the presentation. The content of a child content controller is measured during the layout as usual.
+
+ @param completion The block to execute on the main thread when the measurement is attached
+ */
+- (void)prepareForPresentationWithCompletion:(void (^__nullable)(void))completion;
+
 /**
  Appearance mode of alert.
  The default value is `automatic`. On iOS 13 follows user's Dark Mode setting. On iOS 12 or lower acts as light.
@@ -80,19 +147,30 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nullable, strong, nonatomic) DWAlertAction *preferredAction;
 
 /**
- The text color of active action button
+ Use lightweight layer-backed action views which draw titles from a process-wide cache
+ of pre-rendered images instead of `UILabel`-based ones. Useful for alerts with many actions
+ or when lots of alerts are shown. The default value is NO.
+ Must be set before adding actions.
+ */
+@property (assign, nonatomic) BOOL usesLightweightActionViews;
+
+/**
+ The text color of active action button.
+ Setting `nil` resets the color to the default one.
  */
-@property (strong, nonatomic) UIColor *normalTintColor UI_APPEARANCE_SELECTOR;
+@property (null_resettable, strong, nonatomic) UIColor *normalTintColor UI_APPEARANCE_SELECTOR;
 
 /**
- The text color of disable action button
+ The text color of disable action button.
+ Setting `nil` resets the color to the default one.
  */
-@property (strong, nonatomic) UIColor *disabledTintColor UI_APPEARANCE_SELECTOR;
+@property (null_resettable, strong, nonatomic) UIColor *disabledTintColor UI_APPEARANCE_SELECTOR;
 
 /**
- The text color of active destructive action button
+ The text color of active destructive action button.
+ Setting `nil` resets the color to the default one.
  */
-@property (strong, nonatomic) UIColor *destructiveTintColor UI_APPEARANCE_SELECTOR;
+@property (null_resettable, strong, nonatomic) UIColor *destructiveTintColor UI_APPEARANCE_SELECTOR;
 
 - (instancetype)initWithNibName:(nullable NSString *)nibNameOrNil
                          bundle:(nullable NSBundle *)nibBundleOrNil NS_UNAVAILABLE;
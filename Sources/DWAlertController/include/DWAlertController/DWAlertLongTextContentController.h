@@ -0,0 +1,57 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Content controller for displaying very long text (legal text, logs, etc.) in `DWAlertController`.
+
+ Unlike a content controller with `UILabel`, the text is not measured entirely before the alert
+ is shown. Only the visible part of the text is laid out and rendered, the total height is estimated
+ and refined while the user scrolls the content.
+ */
+@interface DWAlertLongTextContentController : UIViewController
+
+/**
+ The text to display
+ */
+@property (copy, nonatomic) NSAttributedString *attributedText;
+
+/**
+ Configure controller with attributed text
+
+ @param attributedText The text to display
+ @return Configured DWAlertLongTextContentController object
+ */
+- (instancetype)initWithAttributedText:(NSAttributedString *)attributedText NS_DESIGNATED_INITIALIZER;
+
+/**
+ Configure controller with plain text which is displayed using body text style font and label color.
+ The text follows Dynamic Type: it is typeset again when the preferred content size category changes.
+ */
+- (instancetype)initWithText:(NSString *)text;
+
+- (instancetype)initWithNibName:(nullable NSString *)nibNameOrNil
+                         bundle:(nullable NSBundle *)nibBundleOrNil NS_UNAVAILABLE;
+- (nullable instancetype)initWithCoder:(NSCoder *)aDecoder NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
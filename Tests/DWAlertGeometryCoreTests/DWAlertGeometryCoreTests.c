@@ -0,0 +1,397 @@
+//
+//  Created by Andrew Podkovyrin
+//  Copyright © 2019 Dash Core Group. All rights reserved.
+//
+//  Licensed under the MIT License (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  https://opensource.org/licenses/MIT
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// Property-based tests of the geometry core.
+// Inputs are generated by a PRNG with a fixed seed so failures are reproducible.
+
+#include "DWAlertGeometryCore.h"
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define ITERATIONS 100000
+#define EPSILON 1e-9
+
+// Mirrors DWAlertViewActionsMultilineMinimumHeight which DWAlertView passes as the actions minimum height
+#define ACTIONS_MINIMUM_HEIGHT 66.0
+
+static unsigned long failures = 0;
+
+#define CHECK(condition, ...)                                        \
+    do {                                                             \
+        if (!(condition)) {                                          \
+            failures++;                                              \
+            if (failures <= 20) {                                    \
+                fprintf(stderr, "%s:%d: %s: ", __FILE__, __LINE__,   \
+                        #condition);                                 \
+                fprintf(stderr, __VA_ARGS__);                        \
+                fprintf(stderr, "\n");                               \
+            }                                                        \
+        }                                                            \
+    } while (0)
+
+// Random
+
+static uint64_t random_state = 0x2545F4914F6CDD1DULL;
+
+static uint64_t random_next(void) {
+    // xorshift64*
+    random_state ^= random_state >> 12;
+    random_state ^= random_state << 25;
+    random_state ^= random_state >> 27;
+    return random_state * 0x2545F4914F6CDD1DULL;
+}
+
+static double random_double(double min, double max) {
+    const double unit = (double)(random_next() >> 11) / 9007199254740992.0; // [0, 1)
+    return min + unit * (max - min);
+}
+
+static size_t random_size(size_t min, size_t max) {
+    return min + (size_t)(random_next() % (uint64_t)(max - min + 1));
+}
+
+static bool random_bool(void) {
+    return (random_next() & 1) != 0;
+}
+
+/// Separator sizes as they are on 1x, 2x and 3x screens
+static double random_separator_size(void) {
+    static const double sizes[] = {1.0, 0.5, 1.0 / 3.0};
+    return sizes[random_size(0, 2)];
+}
+
+// Tests
+
+typedef struct PaddingCase {
+    double minInset;
+    bool keyboardVisible;
+    bool isPad;
+    bool isPortrait;
+    bool hasTopNotch;
+    double expected;
+} PaddingCase;
+
+static void test_vertical_padding_rules(void) {
+    static const PaddingCase cases[] = {
+        // iPad
+        {0.0, false, true, true, false, 24.0},
+        {0.0, true, true, true, false, 20.0},
+        {0.0, false, true, false, false, 24.0},
+        {0.0, true, true, false, false, 20.0},
+        {24.0, true, true, true, true, 24.0},
+        {30.0, false, true, true, false, 30.0},
+        // iPhone, portrait
+        {20.0, false, false, true, false, 24.0},
+        {20.0, true, false, true, false, 20.0},
+        {44.0, false, false, true, true, 61.0},
+        {44.0, true, false, true, true, 44.0},
+        {47.0, true, false, true, true, 47.0},
+        {0.0, true, false, true, true, 0.0},
+        // iPhone, landscape
+        {0.0, false, false, false, false, 8.0},
+        {0.0, true, false, false, false, 8.0},
+        {0.0, false, false, false, true, 8.0},
+        {21.0, true, false, false, true, 21.0},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const PaddingCase c = cases[i];
+        const double padding = DWAlertGeometryVerticalPadding(c.minInset, c.keyboardVisible, c.isPad, c.isPortrait, c.hasTopNotch);
+        CHECK(padding == c.expected, "case %zu: padding %f, expected %f", i, padding, c.expected);
+    }
+}
+
+static void test_maximum_alert_height_rules(void) {
+    // iPhone 8, portrait
+    DWAlertGeometryContainer container = {375.0, 667.0, 20.0, 0.0, 0.0, false};
+    CHECK(DWAlertGeometryMaximumAlertHeight(container) == 667.0 - 24.0 * 2.0, "iPhone 8");
+    container.keyboardHeight = 260.0;
+    CHECK(DWAlertGeometryMaximumAlertHeight(container) == 667.0 - 20.0 * 2.0 - 260.0, "iPhone 8, keyboard");
+
+    // iPhone X, portrait and landscape
+    container = (DWAlertGeometryContainer){375.0, 812.0, 44.0, 34.0, 0.0, false};
+    CHECK(DWAlertGeometryMaximumAlertHeight(container) == 812.0 - 61.0 * 2.0, "iPhone X");
+    container.keyboardHeight = 291.0;
+    CHECK(DWAlertGeometryMaximumAlertHeight(container) == 812.0 - 44.0 * 2.0 - 291.0, "iPhone X, keyboard");
+    container = (DWAlertGeometryContainer){812.0, 375.0, 0.0, 21.0, 0.0, false};
+    CHECK(DWAlertGeometryMaximumAlertHeight(container) == 375.0 - 21.0 * 2.0, "iPhone X, landscape");
+
+    // iPad
+    container = (DWAlertGeometryContainer){768.0, 1024.0, 20.0, 0.0, 0.0, true};
+    CHECK(DWAlertGeometryMaximumAlertHeight(container) == 1024.0 - 24.0 * 2.0, "iPad");
+    container.keyboardHeight = 313.0;
+    CHECK(DWAlertGeometryMaximumAlertHeight(container) == 1024.0 - 20.0 * 2.0 - 313.0, "iPad, keyboard");
+}
+
+static void test_vertical_padding(void) {
+    for (int i = 0; i < ITERATIONS; i++) {
+        const double minInset = random_double(0.0, 60.0);
+        const bool keyboardVisible = random_bool();
+        const bool isPad = random_bool();
+        const bool isPortrait = random_bool();
+        const bool hasTopNotch = random_bool();
+        const double padding = DWAlertGeometryVerticalPadding(minInset, keyboardVisible, isPad, isPortrait, hasTopNotch);
+        CHECK(padding >= minInset, "padding %f, min inset %f", padding, minInset);
+        if (!keyboardVisible) {
+            CHECK(padding >= 8.0, "padding %f", padding);
+        }
+    }
+}
+
+static void test_maximum_alert_height(void) {
+    for (int i = 0; i < ITERATIONS; i++) {
+        DWAlertGeometryContainer container;
+        container.width = random_double(320.0, 1366.0);
+        container.height = random_double(320.0, 1366.0);
+        container.topInset = random_double(0.0, 50.0);
+        container.bottomInset = random_bool() ? random_double(0.0, 34.0) : 0.0;
+        container.isPad = random_bool();
+        container.keyboardHeight = random_double(1.0, container.height / 2.0);
+
+        const double height = DWAlertGeometryMaximumAlertHeight(container);
+        CHECK(height < container.height - container.keyboardHeight,
+              "height %f, container %f, keyboard %f", height, container.height, container.keyboardHeight);
+
+        // while the keyboard is visible a taller keyboard never leaves more space
+        DWAlertGeometryContainer taller = container;
+        taller.keyboardHeight += random_double(0.0, container.height / 2.0);
+        const double tallerHeight = DWAlertGeometryMaximumAlertHeight(taller);
+        CHECK(tallerHeight <= height, "keyboard %f -> %f, height %f -> %f",
+              container.keyboardHeight, taller.keyboardHeight, height, tallerHeight);
+
+        container.keyboardHeight = 0.0;
+        const double withoutKeyboardHeight = DWAlertGeometryMaximumAlertHeight(container);
+        CHECK(withoutKeyboardHeight < container.height, "height %f, container %f",
+              withoutKeyboardHeight, container.height);
+    }
+}
+
+static void test_category_metrics(void) {
+    for (int category = 1; category < DWAlertGeometryContentSizeCategoryCount; category++) {
+        const double previous = DWAlertGeometryActionButtonMinHeight((DWAlertGeometryContentSizeCategory)(category - 1));
+        const double current = DWAlertGeometryActionButtonMinHeight((DWAlertGeometryContentSizeCategory)category);
+        CHECK(current > previous, "category %d: %f <= %f", category, current, previous);
+
+        const double previousPadding = DWAlertGeometryActionButtonTitlePadding((DWAlertGeometryContentSizeCategory)(category - 1));
+        const double currentPadding = DWAlertGeometryActionButtonTitlePadding((DWAlertGeometryContentSizeCategory)category);
+        CHECK(currentPadding >= previousPadding, "category %d: %f < %f", category, currentPadding, previousPadding);
+    }
+
+    const DWAlertGeometryContentSizeCategory unknown = DWAlertGeometryContentSizeCategoryCount;
+    CHECK(DWAlertGeometryActionButtonMinHeight(unknown) == DWAlertGeometryActionButtonMinHeight(DWAlertGeometryContentSizeCategoryDefault),
+          "unknown category should fall back to the default");
+    CHECK(DWAlertGeometryActionButtonTitlePadding(unknown) == DWAlertGeometryActionButtonTitlePadding(DWAlertGeometryContentSizeCategoryDefault),
+          "unknown category should fall back to the default");
+}
+
+static void test_layout_alert(void) {
+    for (int i = 0; i < ITERATIONS; i++) {
+        DWAlertGeometryLayoutInput input;
+        input.separatorSize = random_separator_size();
+        // includes heights smaller than the actions minimum, e.g. landscape phone with the keyboard
+        input.maxHeight = random_size(0, 9) == 0 ? random_double(0.0, 100.0) : random_double(100.0, 1300.0);
+        input.contentHeight = random_bool() ? random_double(0.0, 2000.0) : 0.0;
+        input.hasActions = random_size(0, 4) != 0;
+        // DWAlertView always passes the same minimum
+        input.actionsMinimumHeight = ACTIONS_MINIMUM_HEIGHT;
+        if (input.hasActions) {
+            const double buttonHeight = random_double(44.5, 125.5);
+            const size_t count = random_size(1, 30);
+            const DWAlertGeometryAxis axis = count == 2 && random_bool() ? DWAlertGeometryAxisHorizontal : DWAlertGeometryAxisVertical;
+            input.actionsHeight = DWAlertGeometryActionsHeight(count, axis, buttonHeight, input.separatorSize);
+        }
+        else {
+            input.actionsHeight = 0.0;
+        }
+
+        const DWAlertGeometryLayout layout = DWAlertGeometryLayoutAlert(input);
+        const double total = layout.contentScrollHeight + layout.actionsScrollHeight;
+
+        CHECK(layout.contentScrollHeight <= input.contentHeight + EPSILON,
+              "content scroll %f, content %f", layout.contentScrollHeight, input.contentHeight);
+        CHECK(layout.actionsScrollHeight <= input.actionsHeight + EPSILON,
+              "actions scroll %f, actions %f", layout.actionsScrollHeight, input.actionsHeight);
+        CHECK(layout.actionsScrollHeight + EPSILON >= fmin(input.actionsHeight, input.actionsMinimumHeight),
+              "actions scroll %f, actions %f, minimum %f",
+              layout.actionsScrollHeight, input.actionsHeight, input.actionsMinimumHeight);
+        CHECK(layout.contentScrollHeight >= 0.0,
+              "content scroll %f, max %f", layout.contentScrollHeight, input.maxHeight);
+        CHECK(layout.actionsScrollHeight >= 0.0,
+              "actions scroll %f, max %f", layout.actionsScrollHeight, input.maxHeight);
+        if (input.maxHeight >= fmin(input.actionsHeight, input.actionsMinimumHeight) + input.separatorSize) {
+            CHECK(total <= input.maxHeight + EPSILON,
+                  "total %f, max %f", total, input.maxHeight);
+        }
+        else {
+            // not even the actions fit, they keep their minimum height and the content is hidden
+            CHECK(layout.contentScrollHeight == 0.0 || !input.hasActions,
+                  "content scroll %f, max %f", layout.contentScrollHeight, input.maxHeight);
+        }
+
+        if (input.contentHeight + input.separatorSize + input.actionsHeight <= input.maxHeight) {
+            CHECK(fabs(layout.contentScrollHeight - input.contentHeight) < EPSILON,
+                  "fitting content is clipped: %f of %f", layout.contentScrollHeight, input.contentHeight);
+            CHECK(fabs(layout.actionsScrollHeight - input.actionsHeight) < EPSILON,
+                  "fitting actions are clipped: %f of %f", layout.actionsScrollHeight, input.actionsHeight);
+        }
+    }
+}
+
+static void test_actions_axis(void) {
+    const double alertWidth = 270.0;
+    for (int i = 0; i < ITERATIONS; i++) {
+        const double separatorSize = random_separator_size();
+        const double actionWidth = alertWidth / 2.0 - separatorSize;
+        const size_t count = random_size(0, 6);
+        double widths[2] = {random_double(0.0, alertWidth), random_double(0.0, alertWidth)};
+
+        const DWAlertGeometryAxis axis = DWAlertGeometryActionsAxis(count == 2 ? widths : NULL, count, alertWidth, separatorSize);
+        if (count < 2) {
+            CHECK(axis == DWAlertGeometryAxisHorizontal, "count %zu", count);
+        }
+        else if (count > 2) {
+            CHECK(axis == DWAlertGeometryAxisVertical, "count %zu", count);
+        }
+        else {
+            const bool fits = widths[0] <= actionWidth && widths[1] <= actionWidth;
+            CHECK(axis == (fits ? DWAlertGeometryAxisHorizontal : DWAlertGeometryAxisVertical),
+                  "widths %f, %f, action width %f", widths[0], widths[1], actionWidth);
+        }
+    }
+}
+
+static void test_actions_height(void) {
+    for (int i = 0; i < ITERATIONS; i++) {
+        const double separatorSize = random_separator_size();
+        const double buttonHeight = random_double(44.5, 125.5);
+        const size_t count = random_size(0, 50);
+
+        const double horizontal = DWAlertGeometryActionsHeight(count, DWAlertGeometryAxisHorizontal, buttonHeight, separatorSize);
+        CHECK(horizontal == buttonHeight, "horizontal %f, button %f", horizontal, buttonHeight);
+
+        const double vertical = DWAlertGeometryActionsHeight(count, DWAlertGeometryAxisVertical, buttonHeight, separatorSize);
+        if (count == 0) {
+            CHECK(vertical == 0.0, "vertical %f", vertical);
+        }
+        else {
+            // a separator following the last button would start right where the actions end
+            const DWAlertGeometryRect last = DWAlertGeometrySeparatorRect(count - 1, count, DWAlertGeometryAxisVertical,
+                                                                          270.0, buttonHeight, separatorSize);
+            CHECK(fabs(vertical - last.y) < 1e-6, "vertical %f, last separator %f", vertical, last.y);
+        }
+    }
+}
+
+static void test_separators_in_rect(void) {
+    for (int i = 0; i < ITERATIONS; i++) {
+        const double width = 270.0;
+        const double separatorSize = random_separator_size();
+        const double buttonHeight = random_bool() ? random_double(44.5, 125.5) : 44.5;
+        const bool vertical = random_size(0, 3) != 0;
+        const DWAlertGeometryAxis axis = vertical ? DWAlertGeometryAxisVertical : DWAlertGeometryAxisHorizontal;
+        const size_t count = vertical ? random_size(0, 500) : random_size(0, 2);
+        const double totalHeight = DWAlertGeometryActionsHeight(count, axis, buttonHeight, separatorSize);
+
+        DWAlertGeometryRect rect;
+        rect.x = random_bool() ? 0.0 : random_double(-50.0, width);
+        rect.y = random_double(-100.0, totalHeight + 100.0);
+        rect.width = random_bool() ? width : random_double(1.0, width);
+        rect.height = random_bool() ? random_double(1.0, 600.0) : random_double(0.1, separatorSize * 2.0);
+
+        const DWAlertGeometryRange range = DWAlertGeometrySeparatorsInRect(rect, count, axis, width, buttonHeight, separatorSize);
+
+        size_t expectedFirst = 0;
+        size_t expectedLength = 0;
+        const size_t separatorsCount = count > 1 ? count - 1 : 0;
+        for (size_t index = 0; index < separatorsCount; index++) {
+            const DWAlertGeometryRect separator = DWAlertGeometrySeparatorRect(index, count, axis, width, buttonHeight, separatorSize);
+            if (DWAlertGeometryRectIntersectsRect(rect, separator)) {
+                if (expectedLength == 0) {
+                    expectedFirst = index;
+                }
+                CHECK(index == expectedFirst + expectedLength, "intersecting separators aren't contiguous at %zu", index);
+                expectedLength++;
+            }
+        }
+
+        CHECK(range.length == expectedLength && (expectedLength == 0 || range.location == expectedFirst),
+              "count %zu, rect {%f, %f, %f, %f}: got {%zu, %zu}, expected {%zu, %zu}",
+              count, rect.x, rect.y, rect.width, rect.height,
+              range.location, range.length, expectedFirst, expectedLength);
+    }
+}
+
+static void test_rect_contains_rect(void) {
+    for (int i = 0; i < ITERATIONS; i++) {
+        DWAlertGeometryRect outer = {random_double(-100.0, 100.0), random_double(-100.0, 100.0),
+                                     random_double(0.0, 200.0), random_double(0.0, 200.0)};
+        if (random_size(0, 9) == 0) {
+            outer.height = 0.0;
+        }
+        const DWAlertGeometryRect inner = {outer.x + outer.width * random_double(0.0, 0.5),
+                                           outer.y + outer.height * random_double(0.0, 0.5),
+                                           outer.width * random_double(0.0, 0.5),
+                                           outer.height * random_double(0.0, 0.5)};
+        const bool empty = outer.width <= 0.0 || outer.height <= 0.0;
+        CHECK(DWAlertGeometryRectContainsRect(outer, inner) == !empty,
+              "outer {%f, %f, %f, %f}", outer.x, outer.y, outer.width, outer.height);
+        CHECK(DWAlertGeometryRectContainsRect(outer, outer) == !empty,
+              "outer {%f, %f, %f, %f}", outer.x, outer.y, outer.width, outer.height);
+
+        const DWAlertGeometryRect shifted = {outer.x + outer.width + 1.0, outer.y, outer.width, outer.height};
+        CHECK(!DWAlertGeometryRectContainsRect(outer, shifted), "shifted rect is contained");
+        CHECK(!DWAlertGeometryRectIntersectsRect(outer, shifted), "shifted rect intersects");
+    }
+}
+
+// Main
+
+typedef struct TestCase {
+    const char *name;
+    void (*function)(void);
+} TestCase;
+
+int main(void) {
+    static const TestCase tests[] = {
+        {"vertical padding rules", test_vertical_padding_rules},
+        {"maximum alert height rules", test_maximum_alert_height_rules},
+        {"vertical padding", test_vertical_padding},
+        {"maximum alert height", test_maximum_alert_height},
+        {"category metrics", test_category_metrics},
+        {"layout alert", test_layout_alert},
+        {"actions axis", test_actions_axis},
+        {"actions height", test_actions_height},
+        {"separators in rect", test_separators_in_rect},
+        {"rect contains rect", test_rect_contains_rect},
+    };
+
+    for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+        const unsigned long failuresBefore = failures;
+        tests[i].function();
+        printf("%s: %s\n", tests[i].name, failures == failuresBefore ? "passed" : "FAILED");
+    }
+
+    if (failures > 0) {
+        fprintf(stderr, "%lu check(s) failed\n", failures);
+        return 1;
+    }
+
+    return 0;
+}